@@ -0,0 +1,186 @@
+// Microbenchmarks for storage::BPlusTree
+//
+// Covers insert (sequential and random order), find, update, remove and
+// range_scan for the key types used by db::Table, across several Order
+// values and tree sizes. Run with --benchmark_filter to select a subset,
+// e.g. --benchmark_filter='BM_Find<DBInt, 64>'.
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+#include "../include/storage/bplustree.h"
+#include "../include/db/table.h"
+
+using toydb::db::DBInt;
+using toydb::db::DBText;
+using toydb::storage::BPlusTree;
+
+namespace {
+
+// Keys are generated from integers so both key types sort the same way
+template<typename Key>
+Key make_key(uint64_t i);
+
+template<>
+DBInt make_key<DBInt>(uint64_t i) {
+    return static_cast<DBInt>(i);
+}
+
+template<>
+DBText make_key<DBText>(uint64_t i) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "user%012llu", static_cast<unsigned long long>(i));
+    return buffer;
+}
+
+template<typename Key>
+std::vector<Key> make_keys(size_t count, bool shuffled) {
+    std::vector<Key> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys.push_back(make_key<Key>(i));
+    }
+    if (shuffled) {
+        std::mt19937_64 rng(42);
+        std::shuffle(keys.begin(), keys.end(), rng);
+    }
+    return keys;
+}
+
+template<typename Key, size_t Order>
+void fill_tree(BPlusTree<Key, size_t, Order>& tree, const std::vector<Key>& keys) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+        tree.insert(keys[i], i);
+    }
+}
+
+// Build a whole tree of state.range(0) keys per iteration
+template<typename Key, size_t Order, bool Sequential>
+void BM_Insert(benchmark::State& state) {
+    auto keys = make_keys<Key>(static_cast<size_t>(state.range(0)), !Sequential);
+
+    for (auto _ : state) {
+        BPlusTree<Key, size_t, Order> tree;
+        fill_tree(tree, keys);
+        benchmark::DoNotOptimize(tree);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// One point lookup of an existing key per iteration
+template<typename Key, size_t Order>
+void BM_Find(benchmark::State& state) {
+    auto keys = make_keys<Key>(static_cast<size_t>(state.range(0)), true);
+    BPlusTree<Key, size_t, Order> tree;
+    fill_tree(tree, keys);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tree.find(keys[i]));
+        if (++i == keys.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 1,000 lookups of existing keys per iteration, through find_many; compare
+// with 1,000 iterations of BM_Find
+template<typename Key, size_t Order>
+void BM_FindMany(benchmark::State& state) {
+    constexpr size_t kBatch = 1000;
+    auto keys = make_keys<Key>(static_cast<size_t>(state.range(0)), true);
+    BPlusTree<Key, size_t, Order> tree;
+    fill_tree(tree, keys);
+
+    std::vector<Key> batch(keys.begin(), keys.begin() + std::min(kBatch, keys.size()));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tree.find_many(batch));
+    }
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+
+// One in-place value update of an existing key per iteration
+template<typename Key, size_t Order>
+void BM_Update(benchmark::State& state) {
+    auto keys = make_keys<Key>(static_cast<size_t>(state.range(0)), true);
+    BPlusTree<Key, size_t, Order> tree;
+    fill_tree(tree, keys);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tree.update(keys[i], i));
+        if (++i == keys.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Remove every key of a freshly built tree per iteration; the rebuild is
+// not timed
+template<typename Key, size_t Order>
+void BM_Remove(benchmark::State& state) {
+    auto keys = make_keys<Key>(static_cast<size_t>(state.range(0)), true);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        BPlusTree<Key, size_t, Order> tree;
+        fill_tree(tree, keys);
+        state.ResumeTiming();
+
+        for (const auto& key : keys) {
+            benchmark::DoNotOptimize(tree.remove(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Scan 100 consecutive keys from a random start per iteration
+template<typename Key, size_t Order>
+void BM_RangeScan(benchmark::State& state) {
+    constexpr uint64_t kScanLength = 100;
+    size_t count = static_cast<size_t>(state.range(0));
+    auto keys = make_keys<Key>(count, true);
+    BPlusTree<Key, size_t, Order> tree;
+    fill_tree(tree, keys);
+
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<uint64_t> starts(0, count - kScanLength);
+    size_t visited = 0;
+
+    for (auto _ : state) {
+        uint64_t start = starts(rng);
+        tree.range_scan(make_key<Key>(start), make_key<Key>(start + kScanLength - 1),
+                        [&visited](const Key&, const size_t& value) {
+                            visited += value & 1;
+                        });
+    }
+    benchmark::DoNotOptimize(visited);
+    state.SetItemsProcessed(state.iterations() * kScanLength);
+}
+
+} // namespace
+
+// Tree sizes from 1K to 64K keys
+#define TOYDB_TREE_SIZES RangeMultiplier(8)->Range(1 << 10, 1 << 16)
+
+#define TOYDB_BPLUSTREE_BENCHMARKS(Key, Order)                                     \
+    BENCHMARK_TEMPLATE(BM_Insert, Key, Order, true)->TOYDB_TREE_SIZES;             \
+    BENCHMARK_TEMPLATE(BM_Insert, Key, Order, false)->TOYDB_TREE_SIZES;            \
+    BENCHMARK_TEMPLATE(BM_Find, Key, Order)->TOYDB_TREE_SIZES;                     \
+    BENCHMARK_TEMPLATE(BM_FindMany, Key, Order)->TOYDB_TREE_SIZES;                 \
+    BENCHMARK_TEMPLATE(BM_Update, Key, Order)->TOYDB_TREE_SIZES;                   \
+    BENCHMARK_TEMPLATE(BM_Remove, Key, Order)->TOYDB_TREE_SIZES;                   \
+    BENCHMARK_TEMPLATE(BM_RangeScan, Key, Order)->TOYDB_TREE_SIZES
+
+// Order 4 is the default used by db::Table
+TOYDB_BPLUSTREE_BENCHMARKS(DBInt, 4);
+TOYDB_BPLUSTREE_BENCHMARKS(DBInt, 16);
+TOYDB_BPLUSTREE_BENCHMARKS(DBInt, 64);
+TOYDB_BPLUSTREE_BENCHMARKS(DBInt, 256);
+TOYDB_BPLUSTREE_BENCHMARKS(DBText, 4);
+TOYDB_BPLUSTREE_BENCHMARKS(DBText, 16);
+TOYDB_BPLUSTREE_BENCHMARKS(DBText, 64);
+TOYDB_BPLUSTREE_BENCHMARKS(DBText, 256);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,196 @@
+-- Parser benchmark corpus. Each '-- @category' line starts a group of
+-- statements (one per line) that toydb_parser_bench reports separately.
+
+-- @category point_select
+SELECT * FROM items WHERE name = 'carol405'
+SELECT * FROM users WHERE id = 75955
+SELECT * FROM users WHERE name = 'frank597'
+SELECT * FROM users WHERE id = 953894
+SELECT * FROM orders WHERE name = 'alice89'
+SELECT * FROM accounts WHERE id = 438486
+SELECT * FROM users WHERE name = 'dave93'
+SELECT * FROM accounts WHERE id = 61982
+SELECT * FROM users WHERE name = 'dave646'
+SELECT * FROM users WHERE id = 605137
+SELECT * FROM accounts WHERE name = 'alice227'
+SELECT * FROM users WHERE id = 583706
+SELECT * FROM orders WHERE name = 'erin430'
+SELECT * FROM orders WHERE id = 566951
+SELECT * FROM users WHERE name = 'judy316'
+SELECT * FROM orders WHERE id = 108062
+SELECT * FROM orders WHERE name = 'frank100'
+SELECT * FROM users WHERE id = 591784
+SELECT * FROM users WHERE name = 'judy211'
+SELECT * FROM accounts WHERE id = 713452
+SELECT * FROM accounts WHERE name = 'frank477'
+SELECT * FROM accounts WHERE id = 379147
+SELECT * FROM items WHERE name = 'dave814'
+SELECT * FROM orders WHERE id = 732949
+SELECT * FROM orders WHERE name = 'bob589'
+SELECT * FROM items WHERE id = 550709
+SELECT * FROM accounts WHERE name = 'frank747'
+SELECT * FROM accounts WHERE id = 301925
+SELECT * FROM users WHERE name = 'bob525'
+SELECT * FROM accounts WHERE id = 172976
+SELECT * FROM items WHERE name = 'carol956'
+SELECT * FROM accounts WHERE id = 442183
+SELECT * FROM users WHERE name = 'bob783'
+SELECT * FROM items WHERE id = 356645
+SELECT * FROM items WHERE name = 'judy509'
+SELECT * FROM accounts WHERE id = 72104
+SELECT * FROM users WHERE name = 'erin486'
+SELECT * FROM users WHERE id = 63617
+SELECT * FROM items WHERE name = 'judy698'
+SELECT * FROM accounts WHERE id = 298421
+
+-- @category filtered_select
+SELECT id, name, email, city FROM users WHERE age >= 42 AND city = 'Lima' AND balance < 469.50
+SELECT id, name, email, city FROM users WHERE age >= 47 AND city = 'Lima' AND balance < 2853.50
+SELECT id, name, email, city FROM users WHERE age >= 57 AND city = 'Lisbon' AND balance < 8188.50
+SELECT id, name, email, city FROM users WHERE age >= 21 AND city = 'Toronto' AND balance < 4809.50
+SELECT id, name, email, city FROM users WHERE age >= 26 AND city = 'Toronto' AND balance < 6619.50
+SELECT id, name, email, city FROM users WHERE age >= 43 AND city = 'Austin' AND balance < 1420.50
+SELECT id, name, email, city FROM users WHERE age >= 28 AND city = 'Austin' AND balance < 6680.50
+SELECT id, name, email, city FROM users WHERE age >= 53 AND city = 'Nairobi' AND balance < 2343.50
+SELECT id, name, email, city FROM users WHERE age >= 45 AND city = 'Nairobi' AND balance < 6904.50
+SELECT id, name, email, city FROM users WHERE age >= 40 AND city = 'Oslo' AND balance < 3880.50
+SELECT id, name, email, city FROM users WHERE age >= 27 AND city = 'Lisbon' AND balance < 2987.50
+SELECT id, name, email, city FROM users WHERE age >= 27 AND city = 'Toronto' AND balance < 3922.50
+SELECT id, name, email, city FROM users WHERE age >= 18 AND city = 'Austin' AND balance < 3087.50
+SELECT id, name, email, city FROM users WHERE age >= 34 AND city = 'Nairobi' AND balance < 167.50
+SELECT id, name, email, city FROM users WHERE age >= 27 AND city = 'Oslo' AND balance < 8858.50
+SELECT id, name, email, city FROM users WHERE age >= 41 AND city = 'Lima' AND balance < 2156.50
+SELECT id, name, email, city FROM users WHERE age >= 50 AND city = 'Berlin' AND balance < 7581.50
+SELECT id, name, email, city FROM users WHERE age >= 53 AND city = 'Oslo' AND balance < 6621.50
+SELECT id, name, email, city FROM users WHERE age >= 43 AND city = 'Oslo' AND balance < 1796.50
+SELECT id, name, email, city FROM users WHERE age >= 48 AND city = 'Oslo' AND balance < 1119.50
+SELECT id, name, email, city FROM users WHERE age >= 30 AND city = 'Lisbon' AND balance < 3520.50
+SELECT id, name, email, city FROM users WHERE age >= 46 AND city = 'Osaka' AND balance < 1901.50
+SELECT id, name, email, city FROM users WHERE age >= 39 AND city = 'Berlin' AND balance < 1777.50
+SELECT id, name, email, city FROM users WHERE age >= 18 AND city = 'Osaka' AND balance < 8891.50
+SELECT id, name, email, city FROM users WHERE age >= 24 AND city = 'Lima' AND balance < 517.50
+SELECT id, name, email, city FROM users WHERE age >= 22 AND city = 'Toronto' AND balance < 6264.50
+SELECT id, name, email, city FROM users WHERE age >= 27 AND city = 'Nairobi' AND balance < 5791.50
+SELECT id, name, email, city FROM users WHERE age >= 56 AND city = 'Lima' AND balance < 7868.50
+SELECT id, name, email, city FROM users WHERE age >= 25 AND city = 'Lisbon' AND balance < 8096.50
+SELECT id, name, email, city FROM users WHERE age >= 47 AND city = 'Austin' AND balance < 8027.50
+
+-- @category single_insert
+INSERT INTO users (id, name, email, age, city) VALUES (1, 'erin', 'erin0@example.com', 28, 'Osaka')
+INSERT INTO users (id, name, email, age, city) VALUES (2, 'bob', 'bob1@example.com', 61, 'Nairobi')
+INSERT INTO users (id, name, email, age, city) VALUES (3, 'heidi', 'heidi2@example.com', 38, 'Berlin')
+INSERT INTO users (id, name, email, age, city) VALUES (4, 'dave', 'dave3@example.com', 85, 'Lima')
+INSERT INTO users (id, name, email, age, city) VALUES (5, 'carol', 'carol4@example.com', 87, 'Berlin')
+INSERT INTO users (id, name, email, age, city) VALUES (6, 'ivan', 'ivan5@example.com', 56, 'Lisbon')
+INSERT INTO users (id, name, email, age, city) VALUES (7, 'erin', 'erin6@example.com', 84, 'Lima')
+INSERT INTO users (id, name, email, age, city) VALUES (8, 'carol', 'carol7@example.com', 63, 'Toronto')
+INSERT INTO users (id, name, email, age, city) VALUES (9, 'ivan', 'ivan8@example.com', 87, 'Lima')
+INSERT INTO users (id, name, email, age, city) VALUES (10, 'dave', 'dave9@example.com', 42, 'Toronto')
+INSERT INTO users (id, name, email, age, city) VALUES (11, 'grace', 'grace10@example.com', 47, 'Toronto')
+INSERT INTO users (id, name, email, age, city) VALUES (12, 'ivan', 'ivan11@example.com', 81, 'Lima')
+INSERT INTO users (id, name, email, age, city) VALUES (13, 'alice', 'alice12@example.com', 21, 'Nairobi')
+INSERT INTO users (id, name, email, age, city) VALUES (14, 'heidi', 'heidi13@example.com', 51, 'Toronto')
+INSERT INTO users (id, name, email, age, city) VALUES (15, 'judy', 'judy14@example.com', 62, 'Austin')
+INSERT INTO users (id, name, email, age, city) VALUES (16, 'frank', 'frank15@example.com', 64, 'Lisbon')
+INSERT INTO users (id, name, email, age, city) VALUES (17, 'dave', 'dave16@example.com', 31, 'Toronto')
+INSERT INTO users (id, name, email, age, city) VALUES (18, 'heidi', 'heidi17@example.com', 43, 'Lima')
+INSERT INTO users (id, name, email, age, city) VALUES (19, 'dave', 'dave18@example.com', 79, 'Berlin')
+INSERT INTO users (id, name, email, age, city) VALUES (20, 'heidi', 'heidi19@example.com', 62, 'Lisbon')
+INSERT INTO users (id, name, email, age, city) VALUES (21, 'bob', 'bob20@example.com', 67, 'Toronto')
+INSERT INTO users (id, name, email, age, city) VALUES (22, 'heidi', 'heidi21@example.com', 40, 'Oslo')
+INSERT INTO users (id, name, email, age, city) VALUES (23, 'frank', 'frank22@example.com', 29, 'Oslo')
+INSERT INTO users (id, name, email, age, city) VALUES (24, 'heidi', 'heidi23@example.com', 69, 'Lisbon')
+INSERT INTO users (id, name, email, age, city) VALUES (25, 'carol', 'carol24@example.com', 39, 'Osaka')
+INSERT INTO users (id, name, email, age, city) VALUES (26, 'alice', 'alice25@example.com', 37, 'Austin')
+INSERT INTO users (id, name, email, age, city) VALUES (27, 'carol', 'carol26@example.com', 78, 'Lima')
+INSERT INTO users (id, name, email, age, city) VALUES (28, 'carol', 'carol27@example.com', 88, 'Osaka')
+INSERT INTO users (id, name, email, age, city) VALUES (29, 'alice', 'alice28@example.com', 19, 'Lisbon')
+INSERT INTO users (id, name, email, age, city) VALUES (30, 'ivan', 'ivan29@example.com', 35, 'Oslo')
+
+-- @category wide_insert
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (0, 'dave', 'dave.0@example.com', 45, 'Berlin', 33008.27, 'note for row 0', 1), (1, 'ivan', 'ivan.1@example.com', 48, 'Lima', 33995.69, 'note for row 1', 1), (2, 'carol', 'carol.2@example.com', 25, 'Lima', 60052.84, 'note for row 2', 1), (3, 'ivan', 'ivan.3@example.com', 34, 'Osaka', 68617.65, 'note for row 3', 0), (4, 'heidi', 'heidi.4@example.com', 41, 'Berlin', 19634.22, 'note for row 4', 0), (5, 'heidi', 'heidi.5@example.com', 33, 'Berlin', 42727.87, 'note for row 5', 1), (6, 'bob', 'bob.6@example.com', 89, 'Berlin', 32570.24, 'note for row 6', 1), (7, 'alice', 'alice.7@example.com', 30, 'Austin', 73626.03, 'note for row 7', 0), (8, 'heidi', 'heidi.8@example.com', 59, 'Toronto', 90797.35, 'note for row 8', 1), (9, 'ivan', 'ivan.9@example.com', 86, 'Austin', 66552.31, 'note for row 9', 1), (10, 'ivan', 'ivan.10@example.com', 43, 'Austin', 17974.53, 'note for row 10', 0), (11, 'grace', 'grace.11@example.com', 74, 'Lima', 9508.85, 'note for row 11', 0), (12, 'grace', 'grace.12@example.com', 27, 'Toronto', 87749.38, 'note for row 12', 0), (13, 'carol', 'carol.13@example.com', 64, 'Osaka', 33175.17, 'note for row 13', 1), (14, 'dave', 'dave.14@example.com', 30, 'Oslo', 63866.20, 'note for row 14', 0), (15, 'carol', 'carol.15@example.com', 73, 'Oslo', 44448.53, 'note for row 15', 0), (16, 'frank', 'frank.16@example.com', 58, 'Lisbon', 94653.46, 'note for row 16', 0), (17, 'frank', 'frank.17@example.com', 88, 'Austin', 57731.90, 'note for row 17', 0), (18, 'grace', 'grace.18@example.com', 60, 'Nairobi', 67143.08, 'note for row 18', 0), (19, 'dave', 'dave.19@example.com', 31, 'Lisbon', 34808.34, 'note for row 19', 0), (20, 'carol', 'carol.20@example.com', 52, 'Osaka', 55345.86, 'note for row 20', 1), (21, 'grace', 'grace.21@example.com', 37, 'Austin', 91805.41, 'note for row 21', 0), (22, 'erin', 'erin.22@example.com', 25, 'Osaka', 55747.09, 'note for row 22', 1), (23, 'alice', 'alice.23@example.com', 29, 'Nairobi', 10976.77, 'note for row 23', 0), (24, 'bob', 'bob.24@example.com', 51, 'Lisbon', 59477.01, 'note for row 24', 1), (25, 'ivan', 'ivan.25@example.com', 71, 'Nairobi', 81487.16, 'note for row 25', 0), (26, 'ivan', 'ivan.26@example.com', 48, 'Lisbon', 21161.33, 'note for row 26', 0), (27, 'carol', 'carol.27@example.com', 43, 'Nairobi', 82401.39, 'note for row 27', 0), (28, 'erin', 'erin.28@example.com', 75, 'Osaka', 35457.44, 'note for row 28', 0), (29, 'erin', 'erin.29@example.com', 22, 'Berlin', 2416.93, 'note for row 29', 0), (30, 'ivan', 'ivan.30@example.com', 78, 'Toronto', 58596.13, 'note for row 30', 1), (31, 'heidi', 'heidi.31@example.com', 87, 'Oslo', 66412.39, 'note for row 31', 0), (32, 'dave', 'dave.32@example.com', 61, 'Toronto', 92631.93, 'note for row 32', 0), (33, 'grace', 'grace.33@example.com', 62, 'Berlin', 17015.01, 'note for row 33', 0), (34, 'erin', 'erin.34@example.com', 73, 'Osaka', 7261.10, 'note for row 34', 1), (35, 'ivan', 'ivan.35@example.com', 54, 'Toronto', 90791.37, 'note for row 35', 0), (36, 'heidi', 'heidi.36@example.com', 41, 'Osaka', 35263.57, 'note for row 36', 0), (37, 'erin', 'erin.37@example.com', 64, 'Lima', 71706.41, 'note for row 37', 0), (38, 'alice', 'alice.38@example.com', 57, 'Toronto', 46738.23, 'note for row 38', 0), (39, 'frank', 'frank.39@example.com', 66, 'Lisbon', 62212.35, 'note for row 39', 0), (40, 'dave', 'dave.40@example.com', 82, 'Berlin', 11908.33, 'note for row 40', 0), (41, 'carol', 'carol.41@example.com', 69, 'Berlin', 51639.02, 'note for row 41', 1), (42, 'erin', 'erin.42@example.com', 47, 'Lisbon', 76753.67, 'note for row 42', 0), (43, 'judy', 'judy.43@example.com', 67, 'Lima', 94460.63, 'note for row 43', 0), (44, 'erin', 'erin.44@example.com', 36, 'Berlin', 93717.65, 'note for row 44', 1), (45, 'ivan', 'ivan.45@example.com', 35, 'Berlin', 89977.74, 'note for row 45', 0), (46, 'bob', 'bob.46@example.com', 21, 'Berlin', 17444.81, 'note for row 46', 1), (47, 'bob', 'bob.47@example.com', 66, 'Austin', 73207.06, 'note for row 47', 0), (48, 'ivan', 'ivan.48@example.com', 49, 'Austin', 34575.00, 'note for row 48', 1), (49, 'bob', 'bob.49@example.com', 82, 'Lisbon', 86415.67, 'note for row 49', 0)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (50, 'heidi', 'heidi.50@example.com', 50, 'Lisbon', 34807.30, 'note for row 50', 0), (51, 'dave', 'dave.51@example.com', 76, 'Austin', 50142.09, 'note for row 51', 1), (52, 'erin', 'erin.52@example.com', 23, 'Toronto', 10154.76, 'note for row 52', 0), (53, 'frank', 'frank.53@example.com', 50, 'Nairobi', 81415.72, 'note for row 53', 0), (54, 'alice', 'alice.54@example.com', 79, 'Berlin', 63674.34, 'note for row 54', 0), (55, 'dave', 'dave.55@example.com', 80, 'Nairobi', 92913.66, 'note for row 55', 1), (56, 'heidi', 'heidi.56@example.com', 77, 'Austin', 15532.70, 'note for row 56', 0), (57, 'erin', 'erin.57@example.com', 28, 'Austin', 2294.37, 'note for row 57', 1), (58, 'bob', 'bob.58@example.com', 82, 'Austin', 35213.49, 'note for row 58', 0), (59, 'dave', 'dave.59@example.com', 27, 'Lisbon', 18578.95, 'note for row 59', 1), (60, 'frank', 'frank.60@example.com', 34, 'Nairobi', 14768.90, 'note for row 60', 1), (61, 'dave', 'dave.61@example.com', 81, 'Austin', 51652.03, 'note for row 61', 0), (62, 'alice', 'alice.62@example.com', 80, 'Austin', 53139.38, 'note for row 62', 0), (63, 'grace', 'grace.63@example.com', 62, 'Oslo', 41428.15, 'note for row 63', 1), (64, 'alice', 'alice.64@example.com', 59, 'Lima', 52200.15, 'note for row 64', 0), (65, 'alice', 'alice.65@example.com', 55, 'Nairobi', 48787.08, 'note for row 65', 1), (66, 'grace', 'grace.66@example.com', 27, 'Lima', 56105.96, 'note for row 66', 1), (67, 'alice', 'alice.67@example.com', 53, 'Lisbon', 6765.84, 'note for row 67', 1), (68, 'carol', 'carol.68@example.com', 49, 'Nairobi', 57178.65, 'note for row 68', 1), (69, 'dave', 'dave.69@example.com', 65, 'Oslo', 3802.97, 'note for row 69', 1), (70, 'ivan', 'ivan.70@example.com', 88, 'Toronto', 94315.10, 'note for row 70', 0), (71, 'grace', 'grace.71@example.com', 75, 'Osaka', 84474.36, 'note for row 71', 1), (72, 'alice', 'alice.72@example.com', 88, 'Osaka', 22382.60, 'note for row 72', 1), (73, 'frank', 'frank.73@example.com', 54, 'Nairobi', 33520.94, 'note for row 73', 1), (74, 'grace', 'grace.74@example.com', 48, 'Nairobi', 63331.71, 'note for row 74', 1), (75, 'bob', 'bob.75@example.com', 39, 'Osaka', 9852.26, 'note for row 75', 1), (76, 'ivan', 'ivan.76@example.com', 46, 'Austin', 43625.97, 'note for row 76', 1), (77, 'grace', 'grace.77@example.com', 35, 'Toronto', 31992.11, 'note for row 77', 0), (78, 'frank', 'frank.78@example.com', 89, 'Lisbon', 41849.30, 'note for row 78', 1), (79, 'erin', 'erin.79@example.com', 90, 'Toronto', 2632.95, 'note for row 79', 1), (80, 'grace', 'grace.80@example.com', 70, 'Toronto', 49396.34, 'note for row 80', 1), (81, 'alice', 'alice.81@example.com', 81, 'Nairobi', 75272.46, 'note for row 81', 0), (82, 'ivan', 'ivan.82@example.com', 85, 'Toronto', 12137.34, 'note for row 82', 0), (83, 'grace', 'grace.83@example.com', 69, 'Austin', 56601.39, 'note for row 83', 0), (84, 'carol', 'carol.84@example.com', 22, 'Oslo', 92997.97, 'note for row 84', 1), (85, 'judy', 'judy.85@example.com', 80, 'Berlin', 9586.50, 'note for row 85', 1), (86, 'heidi', 'heidi.86@example.com', 49, 'Lisbon', 29333.19, 'note for row 86', 0), (87, 'ivan', 'ivan.87@example.com', 31, 'Austin', 11141.70, 'note for row 87', 0), (88, 'alice', 'alice.88@example.com', 34, 'Toronto', 74630.04, 'note for row 88', 1), (89, 'carol', 'carol.89@example.com', 50, 'Oslo', 91564.97, 'note for row 89', 0), (90, 'bob', 'bob.90@example.com', 27, 'Nairobi', 68738.74, 'note for row 90', 0), (91, 'grace', 'grace.91@example.com', 51, 'Toronto', 78782.00, 'note for row 91', 0), (92, 'ivan', 'ivan.92@example.com', 56, 'Austin', 36517.40, 'note for row 92', 0), (93, 'heidi', 'heidi.93@example.com', 85, 'Toronto', 71696.31, 'note for row 93', 0), (94, 'grace', 'grace.94@example.com', 57, 'Berlin', 2855.24, 'note for row 94', 1), (95, 'grace', 'grace.95@example.com', 28, 'Nairobi', 29863.85, 'note for row 95', 1), (96, 'frank', 'frank.96@example.com', 47, 'Austin', 4469.89, 'note for row 96', 1), (97, 'grace', 'grace.97@example.com', 64, 'Oslo', 25962.00, 'note for row 97', 1), (98, 'ivan', 'ivan.98@example.com', 26, 'Toronto', 64971.25, 'note for row 98', 1), (99, 'dave', 'dave.99@example.com', 47, 'Austin', 29024.33, 'note for row 99', 1)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (100, 'bob', 'bob.100@example.com', 81, 'Osaka', 29271.62, 'note for row 100', 1), (101, 'alice', 'alice.101@example.com', 36, 'Oslo', 7124.27, 'note for row 101', 0), (102, 'judy', 'judy.102@example.com', 36, 'Oslo', 6794.90, 'note for row 102', 0), (103, 'carol', 'carol.103@example.com', 68, 'Austin', 93327.40, 'note for row 103', 0), (104, 'bob', 'bob.104@example.com', 39, 'Lima', 24993.23, 'note for row 104', 1), (105, 'alice', 'alice.105@example.com', 57, 'Oslo', 49005.42, 'note for row 105', 1), (106, 'carol', 'carol.106@example.com', 31, 'Berlin', 10255.35, 'note for row 106', 0), (107, 'frank', 'frank.107@example.com', 71, 'Lisbon', 73548.97, 'note for row 107', 0), (108, 'grace', 'grace.108@example.com', 63, 'Nairobi', 56681.11, 'note for row 108', 0), (109, 'heidi', 'heidi.109@example.com', 43, 'Lima', 70979.57, 'note for row 109', 0), (110, 'frank', 'frank.110@example.com', 64, 'Austin', 3969.80, 'note for row 110', 1), (111, 'dave', 'dave.111@example.com', 69, 'Berlin', 49226.04, 'note for row 111', 1), (112, 'bob', 'bob.112@example.com', 25, 'Nairobi', 25551.95, 'note for row 112', 0), (113, 'judy', 'judy.113@example.com', 61, 'Lima', 35692.42, 'note for row 113', 0), (114, 'erin', 'erin.114@example.com', 58, 'Nairobi', 38981.00, 'note for row 114', 0), (115, 'alice', 'alice.115@example.com', 47, 'Lisbon', 62283.91, 'note for row 115', 1), (116, 'grace', 'grace.116@example.com', 50, 'Oslo', 64680.16, 'note for row 116', 1), (117, 'carol', 'carol.117@example.com', 19, 'Nairobi', 90716.98, 'note for row 117', 0), (118, 'judy', 'judy.118@example.com', 48, 'Lima', 41883.58, 'note for row 118', 1), (119, 'judy', 'judy.119@example.com', 28, 'Toronto', 51338.96, 'note for row 119', 0), (120, 'dave', 'dave.120@example.com', 70, 'Lisbon', 85137.04, 'note for row 120', 1), (121, 'ivan', 'ivan.121@example.com', 87, 'Lima', 21062.54, 'note for row 121', 0), (122, 'bob', 'bob.122@example.com', 51, 'Lisbon', 27307.12, 'note for row 122', 1), (123, 'heidi', 'heidi.123@example.com', 75, 'Osaka', 30696.17, 'note for row 123', 1), (124, 'heidi', 'heidi.124@example.com', 48, 'Lisbon', 38525.37, 'note for row 124', 1), (125, 'judy', 'judy.125@example.com', 52, 'Lima', 33299.94, 'note for row 125', 1), (126, 'dave', 'dave.126@example.com', 74, 'Toronto', 24344.31, 'note for row 126', 0), (127, 'carol', 'carol.127@example.com', 54, 'Toronto', 42773.08, 'note for row 127', 1), (128, 'erin', 'erin.128@example.com', 49, 'Toronto', 85149.12, 'note for row 128', 1), (129, 'alice', 'alice.129@example.com', 31, 'Berlin', 62228.29, 'note for row 129', 1), (130, 'frank', 'frank.130@example.com', 23, 'Nairobi', 30525.15, 'note for row 130', 0), (131, 'dave', 'dave.131@example.com', 42, 'Lisbon', 48789.65, 'note for row 131', 0), (132, 'heidi', 'heidi.132@example.com', 51, 'Berlin', 13864.81, 'note for row 132', 1), (133, 'dave', 'dave.133@example.com', 22, 'Lima', 44566.18, 'note for row 133', 0), (134, 'dave', 'dave.134@example.com', 50, 'Berlin', 78567.93, 'note for row 134', 0), (135, 'alice', 'alice.135@example.com', 59, 'Oslo', 88908.47, 'note for row 135', 0), (136, 'judy', 'judy.136@example.com', 57, 'Lisbon', 26661.04, 'note for row 136', 1), (137, 'ivan', 'ivan.137@example.com', 79, 'Lisbon', 53499.12, 'note for row 137', 1), (138, 'ivan', 'ivan.138@example.com', 37, 'Lisbon', 85597.20, 'note for row 138', 1), (139, 'erin', 'erin.139@example.com', 70, 'Nairobi', 87531.39, 'note for row 139', 1), (140, 'alice', 'alice.140@example.com', 57, 'Lima', 54274.53, 'note for row 140', 0), (141, 'frank', 'frank.141@example.com', 43, 'Oslo', 95424.51, 'note for row 141', 0), (142, 'alice', 'alice.142@example.com', 73, 'Osaka', 55542.14, 'note for row 142', 0), (143, 'grace', 'grace.143@example.com', 64, 'Austin', 21305.16, 'note for row 143', 0), (144, 'alice', 'alice.144@example.com', 88, 'Osaka', 83973.50, 'note for row 144', 0), (145, 'judy', 'judy.145@example.com', 65, 'Osaka', 19121.44, 'note for row 145', 1), (146, 'carol', 'carol.146@example.com', 84, 'Osaka', 8794.13, 'note for row 146', 1), (147, 'heidi', 'heidi.147@example.com', 43, 'Nairobi', 16600.05, 'note for row 147', 1), (148, 'frank', 'frank.148@example.com', 24, 'Oslo', 11310.91, 'note for row 148', 0), (149, 'dave', 'dave.149@example.com', 69, 'Toronto', 61991.23, 'note for row 149', 0)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (150, 'alice', 'alice.150@example.com', 69, 'Osaka', 50276.45, 'note for row 150', 0), (151, 'carol', 'carol.151@example.com', 49, 'Toronto', 5386.71, 'note for row 151', 0), (152, 'frank', 'frank.152@example.com', 33, 'Oslo', 78580.58, 'note for row 152', 1), (153, 'grace', 'grace.153@example.com', 57, 'Toronto', 55802.49, 'note for row 153', 1), (154, 'heidi', 'heidi.154@example.com', 82, 'Austin', 23430.02, 'note for row 154', 0), (155, 'judy', 'judy.155@example.com', 80, 'Austin', 30834.57, 'note for row 155', 1), (156, 'carol', 'carol.156@example.com', 78, 'Oslo', 14034.08, 'note for row 156', 0), (157, 'frank', 'frank.157@example.com', 73, 'Lima', 12021.56, 'note for row 157', 0), (158, 'alice', 'alice.158@example.com', 34, 'Lisbon', 96138.40, 'note for row 158', 0), (159, 'alice', 'alice.159@example.com', 82, 'Oslo', 85556.17, 'note for row 159', 0), (160, 'bob', 'bob.160@example.com', 32, 'Toronto', 17251.62, 'note for row 160', 1), (161, 'carol', 'carol.161@example.com', 46, 'Lisbon', 45992.78, 'note for row 161', 1), (162, 'carol', 'carol.162@example.com', 59, 'Nairobi', 59821.18, 'note for row 162', 1), (163, 'ivan', 'ivan.163@example.com', 79, 'Toronto', 77579.33, 'note for row 163', 0), (164, 'frank', 'frank.164@example.com', 65, 'Berlin', 26075.23, 'note for row 164', 1), (165, 'carol', 'carol.165@example.com', 53, 'Lima', 49393.21, 'note for row 165', 1), (166, 'bob', 'bob.166@example.com', 85, 'Berlin', 83403.46, 'note for row 166', 1), (167, 'ivan', 'ivan.167@example.com', 84, 'Lisbon', 33034.68, 'note for row 167', 1), (168, 'frank', 'frank.168@example.com', 51, 'Oslo', 48358.73, 'note for row 168', 0), (169, 'frank', 'frank.169@example.com', 60, 'Lisbon', 57970.29, 'note for row 169', 0), (170, 'judy', 'judy.170@example.com', 24, 'Nairobi', 67647.32, 'note for row 170', 1), (171, 'judy', 'judy.171@example.com', 58, 'Berlin', 97926.04, 'note for row 171', 0), (172, 'carol', 'carol.172@example.com', 55, 'Oslo', 54747.65, 'note for row 172', 1), (173, 'alice', 'alice.173@example.com', 34, 'Austin', 29787.78, 'note for row 173', 0), (174, 'alice', 'alice.174@example.com', 24, 'Berlin', 74333.45, 'note for row 174', 1), (175, 'bob', 'bob.175@example.com', 84, 'Lima', 70007.28, 'note for row 175', 1), (176, 'judy', 'judy.176@example.com', 56, 'Osaka', 26762.46, 'note for row 176', 1), (177, 'carol', 'carol.177@example.com', 35, 'Berlin', 31927.90, 'note for row 177', 0), (178, 'heidi', 'heidi.178@example.com', 30, 'Lisbon', 83651.18, 'note for row 178', 1), (179, 'grace', 'grace.179@example.com', 51, 'Berlin', 7357.82, 'note for row 179', 1), (180, 'judy', 'judy.180@example.com', 74, 'Austin', 32571.21, 'note for row 180', 0), (181, 'alice', 'alice.181@example.com', 25, 'Berlin', 53213.23, 'note for row 181', 0), (182, 'carol', 'carol.182@example.com', 25, 'Lisbon', 1618.78, 'note for row 182', 0), (183, 'carol', 'carol.183@example.com', 70, 'Toronto', 67929.77, 'note for row 183', 1), (184, 'judy', 'judy.184@example.com', 40, 'Nairobi', 8358.38, 'note for row 184', 0), (185, 'heidi', 'heidi.185@example.com', 86, 'Berlin', 49172.55, 'note for row 185', 1), (186, 'bob', 'bob.186@example.com', 75, 'Osaka', 29615.13, 'note for row 186', 1), (187, 'dave', 'dave.187@example.com', 22, 'Lisbon', 43976.95, 'note for row 187', 1), (188, 'alice', 'alice.188@example.com', 52, 'Oslo', 89880.66, 'note for row 188', 1), (189, 'erin', 'erin.189@example.com', 45, 'Lisbon', 66509.01, 'note for row 189', 0), (190, 'erin', 'erin.190@example.com', 48, 'Toronto', 20864.95, 'note for row 190', 1), (191, 'dave', 'dave.191@example.com', 67, 'Lima', 78804.30, 'note for row 191', 1), (192, 'ivan', 'ivan.192@example.com', 78, 'Austin', 69549.89, 'note for row 192', 0), (193, 'alice', 'alice.193@example.com', 73, 'Toronto', 74755.39, 'note for row 193', 0), (194, 'grace', 'grace.194@example.com', 27, 'Osaka', 18952.04, 'note for row 194', 0), (195, 'bob', 'bob.195@example.com', 31, 'Osaka', 45201.18, 'note for row 195', 0), (196, 'alice', 'alice.196@example.com', 23, 'Osaka', 90783.82, 'note for row 196', 0), (197, 'bob', 'bob.197@example.com', 23, 'Lisbon', 77394.97, 'note for row 197', 1), (198, 'dave', 'dave.198@example.com', 86, 'Lisbon', 99060.91, 'note for row 198', 1), (199, 'bob', 'bob.199@example.com', 49, 'Toronto', 26628.14, 'note for row 199', 0)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (200, 'alice', 'alice.200@example.com', 29, 'Nairobi', 62536.12, 'note for row 200', 0), (201, 'bob', 'bob.201@example.com', 44, 'Nairobi', 41830.43, 'note for row 201', 1), (202, 'erin', 'erin.202@example.com', 20, 'Lima', 33646.36, 'note for row 202', 0), (203, 'frank', 'frank.203@example.com', 59, 'Austin', 37702.79, 'note for row 203', 0), (204, 'grace', 'grace.204@example.com', 21, 'Oslo', 67976.98, 'note for row 204', 0), (205, 'frank', 'frank.205@example.com', 78, 'Berlin', 70501.72, 'note for row 205', 0), (206, 'bob', 'bob.206@example.com', 54, 'Osaka', 57154.00, 'note for row 206', 0), (207, 'erin', 'erin.207@example.com', 24, 'Berlin', 45587.62, 'note for row 207', 0), (208, 'heidi', 'heidi.208@example.com', 41, 'Austin', 77667.44, 'note for row 208', 1), (209, 'judy', 'judy.209@example.com', 38, 'Nairobi', 28143.89, 'note for row 209', 0), (210, 'heidi', 'heidi.210@example.com', 39, 'Lisbon', 83431.98, 'note for row 210', 0), (211, 'heidi', 'heidi.211@example.com', 89, 'Lisbon', 82304.41, 'note for row 211', 1), (212, 'bob', 'bob.212@example.com', 69, 'Oslo', 97677.11, 'note for row 212', 1), (213, 'alice', 'alice.213@example.com', 65, 'Toronto', 39733.33, 'note for row 213', 1), (214, 'ivan', 'ivan.214@example.com', 82, 'Osaka', 49716.80, 'note for row 214', 0), (215, 'heidi', 'heidi.215@example.com', 34, 'Berlin', 45676.74, 'note for row 215', 1), (216, 'ivan', 'ivan.216@example.com', 37, 'Austin', 86782.70, 'note for row 216', 1), (217, 'carol', 'carol.217@example.com', 77, 'Austin', 90316.98, 'note for row 217', 1), (218, 'judy', 'judy.218@example.com', 47, 'Osaka', 43785.59, 'note for row 218', 0), (219, 'ivan', 'ivan.219@example.com', 42, 'Nairobi', 39519.96, 'note for row 219', 0), (220, 'carol', 'carol.220@example.com', 49, 'Lima', 79022.66, 'note for row 220', 1), (221, 'carol', 'carol.221@example.com', 48, 'Lima', 24808.33, 'note for row 221', 0), (222, 'carol', 'carol.222@example.com', 31, 'Toronto', 50362.19, 'note for row 222', 0), (223, 'erin', 'erin.223@example.com', 56, 'Oslo', 35890.25, 'note for row 223', 0), (224, 'bob', 'bob.224@example.com', 53, 'Toronto', 50900.59, 'note for row 224', 0), (225, 'alice', 'alice.225@example.com', 69, 'Oslo', 90890.28, 'note for row 225', 1), (226, 'heidi', 'heidi.226@example.com', 20, 'Osaka', 33713.77, 'note for row 226', 1), (227, 'alice', 'alice.227@example.com', 49, 'Oslo', 91902.73, 'note for row 227', 1), (228, 'dave', 'dave.228@example.com', 47, 'Osaka', 84087.15, 'note for row 228', 1), (229, 'grace', 'grace.229@example.com', 58, 'Nairobi', 82349.89, 'note for row 229', 0), (230, 'grace', 'grace.230@example.com', 49, 'Oslo', 93474.91, 'note for row 230', 0), (231, 'erin', 'erin.231@example.com', 72, 'Austin', 59663.02, 'note for row 231', 1), (232, 'ivan', 'ivan.232@example.com', 41, 'Lima', 1393.49, 'note for row 232', 1), (233, 'bob', 'bob.233@example.com', 22, 'Nairobi', 71219.27, 'note for row 233', 0), (234, 'dave', 'dave.234@example.com', 84, 'Lima', 13249.73, 'note for row 234', 1), (235, 'ivan', 'ivan.235@example.com', 44, 'Austin', 67133.02, 'note for row 235', 1), (236, 'ivan', 'ivan.236@example.com', 61, 'Oslo', 97269.58, 'note for row 236', 0), (237, 'carol', 'carol.237@example.com', 68, 'Lisbon', 95565.78, 'note for row 237', 1), (238, 'alice', 'alice.238@example.com', 50, 'Nairobi', 50048.51, 'note for row 238', 0), (239, 'alice', 'alice.239@example.com', 27, 'Oslo', 55121.80, 'note for row 239', 1), (240, 'judy', 'judy.240@example.com', 51, 'Lisbon', 29416.38, 'note for row 240', 1), (241, 'ivan', 'ivan.241@example.com', 46, 'Oslo', 60570.27, 'note for row 241', 0), (242, 'carol', 'carol.242@example.com', 26, 'Toronto', 61493.82, 'note for row 242', 0), (243, 'carol', 'carol.243@example.com', 63, 'Oslo', 61354.37, 'note for row 243', 0), (244, 'heidi', 'heidi.244@example.com', 63, 'Toronto', 35051.90, 'note for row 244', 1), (245, 'erin', 'erin.245@example.com', 72, 'Osaka', 63120.00, 'note for row 245', 1), (246, 'frank', 'frank.246@example.com', 49, 'Nairobi', 41985.61, 'note for row 246', 1), (247, 'grace', 'grace.247@example.com', 28, 'Lima', 20021.38, 'note for row 247', 1), (248, 'alice', 'alice.248@example.com', 28, 'Lima', 18402.67, 'note for row 248', 1), (249, 'judy', 'judy.249@example.com', 19, 'Berlin', 27492.09, 'note for row 249', 1)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (250, 'erin', 'erin.250@example.com', 30, 'Osaka', 30623.23, 'note for row 250', 1), (251, 'frank', 'frank.251@example.com', 37, 'Toronto', 52754.68, 'note for row 251', 0), (252, 'judy', 'judy.252@example.com', 29, 'Nairobi', 25869.63, 'note for row 252', 0), (253, 'ivan', 'ivan.253@example.com', 28, 'Austin', 87979.14, 'note for row 253', 0), (254, 'erin', 'erin.254@example.com', 71, 'Toronto', 18263.60, 'note for row 254', 1), (255, 'ivan', 'ivan.255@example.com', 25, 'Austin', 61222.18, 'note for row 255', 1), (256, 'dave', 'dave.256@example.com', 81, 'Osaka', 70718.76, 'note for row 256', 0), (257, 'carol', 'carol.257@example.com', 59, 'Austin', 91211.72, 'note for row 257', 1), (258, 'erin', 'erin.258@example.com', 77, 'Lima', 55812.53, 'note for row 258', 0), (259, 'carol', 'carol.259@example.com', 64, 'Berlin', 2694.78, 'note for row 259', 0), (260, 'frank', 'frank.260@example.com', 30, 'Austin', 63527.96, 'note for row 260', 0), (261, 'alice', 'alice.261@example.com', 45, 'Oslo', 81956.16, 'note for row 261', 1), (262, 'bob', 'bob.262@example.com', 64, 'Lima', 62198.99, 'note for row 262', 0), (263, 'erin', 'erin.263@example.com', 73, 'Lima', 55363.32, 'note for row 263', 0), (264, 'erin', 'erin.264@example.com', 55, 'Lima', 64714.51, 'note for row 264', 1), (265, 'ivan', 'ivan.265@example.com', 52, 'Lima', 26677.83, 'note for row 265', 1), (266, 'bob', 'bob.266@example.com', 60, 'Toronto', 41562.91, 'note for row 266', 1), (267, 'carol', 'carol.267@example.com', 29, 'Berlin', 52281.92, 'note for row 267', 1), (268, 'ivan', 'ivan.268@example.com', 24, 'Oslo', 39374.13, 'note for row 268', 0), (269, 'alice', 'alice.269@example.com', 42, 'Austin', 79781.98, 'note for row 269', 0), (270, 'ivan', 'ivan.270@example.com', 87, 'Oslo', 80831.18, 'note for row 270', 0), (271, 'dave', 'dave.271@example.com', 23, 'Austin', 81956.97, 'note for row 271', 0), (272, 'bob', 'bob.272@example.com', 41, 'Berlin', 55256.99, 'note for row 272', 0), (273, 'alice', 'alice.273@example.com', 65, 'Osaka', 40546.71, 'note for row 273', 1), (274, 'erin', 'erin.274@example.com', 41, 'Oslo', 4488.40, 'note for row 274', 0), (275, 'grace', 'grace.275@example.com', 90, 'Berlin', 65243.72, 'note for row 275', 0), (276, 'bob', 'bob.276@example.com', 71, 'Oslo', 58519.08, 'note for row 276', 0), (277, 'grace', 'grace.277@example.com', 37, 'Austin', 54056.70, 'note for row 277', 0), (278, 'bob', 'bob.278@example.com', 78, 'Toronto', 19892.80, 'note for row 278', 0), (279, 'grace', 'grace.279@example.com', 18, 'Berlin', 89621.85, 'note for row 279', 0), (280, 'bob', 'bob.280@example.com', 45, 'Lisbon', 16904.60, 'note for row 280', 0), (281, 'erin', 'erin.281@example.com', 90, 'Toronto', 59084.93, 'note for row 281', 0), (282, 'alice', 'alice.282@example.com', 64, 'Osaka', 95646.97, 'note for row 282', 0), (283, 'erin', 'erin.283@example.com', 89, 'Austin', 60369.85, 'note for row 283', 1), (284, 'alice', 'alice.284@example.com', 22, 'Berlin', 7936.01, 'note for row 284', 0), (285, 'grace', 'grace.285@example.com', 57, 'Nairobi', 95609.76, 'note for row 285', 0), (286, 'heidi', 'heidi.286@example.com', 25, 'Lima', 48177.73, 'note for row 286', 1), (287, 'heidi', 'heidi.287@example.com', 39, 'Osaka', 15296.46, 'note for row 287', 0), (288, 'grace', 'grace.288@example.com', 79, 'Oslo', 59343.34, 'note for row 288', 1), (289, 'erin', 'erin.289@example.com', 53, 'Berlin', 81506.83, 'note for row 289', 1), (290, 'judy', 'judy.290@example.com', 19, 'Osaka', 78792.39, 'note for row 290', 1), (291, 'dave', 'dave.291@example.com', 66, 'Oslo', 89760.48, 'note for row 291', 0), (292, 'heidi', 'heidi.292@example.com', 54, 'Berlin', 42143.33, 'note for row 292', 1), (293, 'grace', 'grace.293@example.com', 38, 'Berlin', 37817.18, 'note for row 293', 0), (294, 'erin', 'erin.294@example.com', 88, 'Austin', 45462.68, 'note for row 294', 0), (295, 'ivan', 'ivan.295@example.com', 88, 'Austin', 50035.25, 'note for row 295', 0), (296, 'erin', 'erin.296@example.com', 25, 'Oslo', 60990.90, 'note for row 296', 0), (297, 'erin', 'erin.297@example.com', 19, 'Oslo', 60256.69, 'note for row 297', 0), (298, 'ivan', 'ivan.298@example.com', 63, 'Lisbon', 30522.50, 'note for row 298', 1), (299, 'ivan', 'ivan.299@example.com', 59, 'Austin', 66344.75, 'note for row 299', 0)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (300, 'dave', 'dave.300@example.com', 45, 'Toronto', 12083.23, 'note for row 300', 1), (301, 'frank', 'frank.301@example.com', 90, 'Lima', 52755.99, 'note for row 301', 0), (302, 'dave', 'dave.302@example.com', 23, 'Austin', 49026.13, 'note for row 302', 1), (303, 'heidi', 'heidi.303@example.com', 28, 'Osaka', 41391.76, 'note for row 303', 0), (304, 'frank', 'frank.304@example.com', 53, 'Berlin', 12331.04, 'note for row 304', 0), (305, 'judy', 'judy.305@example.com', 80, 'Toronto', 34288.99, 'note for row 305', 1), (306, 'grace', 'grace.306@example.com', 30, 'Austin', 77741.77, 'note for row 306', 0), (307, 'erin', 'erin.307@example.com', 22, 'Lima', 26344.23, 'note for row 307', 1), (308, 'bob', 'bob.308@example.com', 21, 'Berlin', 4562.71, 'note for row 308', 1), (309, 'heidi', 'heidi.309@example.com', 80, 'Lisbon', 78389.81, 'note for row 309', 1), (310, 'bob', 'bob.310@example.com', 29, 'Nairobi', 41774.72, 'note for row 310', 0), (311, 'bob', 'bob.311@example.com', 82, 'Oslo', 23942.57, 'note for row 311', 0), (312, 'frank', 'frank.312@example.com', 48, 'Toronto', 22560.04, 'note for row 312', 1), (313, 'frank', 'frank.313@example.com', 25, 'Berlin', 6165.33, 'note for row 313', 1), (314, 'alice', 'alice.314@example.com', 30, 'Osaka', 41639.96, 'note for row 314', 0), (315, 'dave', 'dave.315@example.com', 56, 'Austin', 99339.83, 'note for row 315', 0), (316, 'heidi', 'heidi.316@example.com', 59, 'Lima', 33686.49, 'note for row 316', 0), (317, 'frank', 'frank.317@example.com', 79, 'Oslo', 22095.56, 'note for row 317', 0), (318, 'carol', 'carol.318@example.com', 19, 'Austin', 94008.24, 'note for row 318', 0), (319, 'carol', 'carol.319@example.com', 46, 'Lisbon', 81088.47, 'note for row 319', 0), (320, 'heidi', 'heidi.320@example.com', 30, 'Oslo', 2848.80, 'note for row 320', 0), (321, 'heidi', 'heidi.321@example.com', 61, 'Lima', 30655.61, 'note for row 321', 0), (322, 'frank', 'frank.322@example.com', 36, 'Lima', 29052.94, 'note for row 322', 0), (323, 'carol', 'carol.323@example.com', 75, 'Osaka', 57536.19, 'note for row 323', 1), (324, 'grace', 'grace.324@example.com', 70, 'Toronto', 20406.03, 'note for row 324', 1), (325, 'judy', 'judy.325@example.com', 55, 'Lima', 21993.33, 'note for row 325', 1), (326, 'bob', 'bob.326@example.com', 58, 'Austin', 63233.14, 'note for row 326', 0), (327, 'ivan', 'ivan.327@example.com', 25, 'Toronto', 73392.61, 'note for row 327', 1), (328, 'bob', 'bob.328@example.com', 50, 'Toronto', 47746.55, 'note for row 328', 1), (329, 'dave', 'dave.329@example.com', 48, 'Lisbon', 51137.37, 'note for row 329', 1), (330, 'carol', 'carol.330@example.com', 25, 'Nairobi', 18920.81, 'note for row 330', 0), (331, 'heidi', 'heidi.331@example.com', 82, 'Lima', 66949.17, 'note for row 331', 1), (332, 'alice', 'alice.332@example.com', 85, 'Nairobi', 24355.46, 'note for row 332', 1), (333, 'alice', 'alice.333@example.com', 70, 'Toronto', 36286.73, 'note for row 333', 0), (334, 'carol', 'carol.334@example.com', 41, 'Toronto', 93273.22, 'note for row 334', 0), (335, 'judy', 'judy.335@example.com', 28, 'Lisbon', 79764.93, 'note for row 335', 1), (336, 'erin', 'erin.336@example.com', 40, 'Toronto', 17962.78, 'note for row 336', 0), (337, 'judy', 'judy.337@example.com', 57, 'Toronto', 1315.08, 'note for row 337', 1), (338, 'alice', 'alice.338@example.com', 84, 'Lima', 43937.36, 'note for row 338', 1), (339, 'bob', 'bob.339@example.com', 19, 'Oslo', 62470.17, 'note for row 339', 1), (340, 'dave', 'dave.340@example.com', 41, 'Lima', 4806.20, 'note for row 340', 1), (341, 'judy', 'judy.341@example.com', 18, 'Lima', 68134.57, 'note for row 341', 0), (342, 'bob', 'bob.342@example.com', 63, 'Toronto', 42071.99, 'note for row 342', 1), (343, 'judy', 'judy.343@example.com', 25, 'Nairobi', 14114.93, 'note for row 343', 1), (344, 'heidi', 'heidi.344@example.com', 83, 'Berlin', 69535.68, 'note for row 344', 0), (345, 'alice', 'alice.345@example.com', 49, 'Lisbon', 29320.79, 'note for row 345', 0), (346, 'carol', 'carol.346@example.com', 31, 'Nairobi', 32828.71, 'note for row 346', 0), (347, 'alice', 'alice.347@example.com', 30, 'Toronto', 34264.02, 'note for row 347', 1), (348, 'ivan', 'ivan.348@example.com', 48, 'Austin', 13482.44, 'note for row 348', 0), (349, 'carol', 'carol.349@example.com', 23, 'Nairobi', 16128.59, 'note for row 349', 1)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (350, 'judy', 'judy.350@example.com', 82, 'Nairobi', 14423.15, 'note for row 350', 0), (351, 'grace', 'grace.351@example.com', 35, 'Toronto', 29757.18, 'note for row 351', 1), (352, 'grace', 'grace.352@example.com', 39, 'Berlin', 83229.49, 'note for row 352', 1), (353, 'judy', 'judy.353@example.com', 85, 'Berlin', 51856.06, 'note for row 353', 1), (354, 'frank', 'frank.354@example.com', 69, 'Toronto', 43919.91, 'note for row 354', 1), (355, 'judy', 'judy.355@example.com', 59, 'Oslo', 73541.06, 'note for row 355', 1), (356, 'ivan', 'ivan.356@example.com', 36, 'Lima', 32674.54, 'note for row 356', 0), (357, 'frank', 'frank.357@example.com', 31, 'Osaka', 9078.41, 'note for row 357', 1), (358, 'dave', 'dave.358@example.com', 82, 'Berlin', 29553.17, 'note for row 358', 1), (359, 'grace', 'grace.359@example.com', 76, 'Berlin', 5277.04, 'note for row 359', 1), (360, 'judy', 'judy.360@example.com', 52, 'Berlin', 81429.12, 'note for row 360', 1), (361, 'bob', 'bob.361@example.com', 84, 'Berlin', 56844.30, 'note for row 361', 0), (362, 'erin', 'erin.362@example.com', 32, 'Nairobi', 45554.82, 'note for row 362', 0), (363, 'bob', 'bob.363@example.com', 25, 'Nairobi', 11072.59, 'note for row 363', 0), (364, 'heidi', 'heidi.364@example.com', 33, 'Osaka', 38482.52, 'note for row 364', 1), (365, 'erin', 'erin.365@example.com', 49, 'Lisbon', 97046.69, 'note for row 365', 1), (366, 'heidi', 'heidi.366@example.com', 90, 'Toronto', 85243.49, 'note for row 366', 0), (367, 'ivan', 'ivan.367@example.com', 64, 'Austin', 71831.38, 'note for row 367', 1), (368, 'heidi', 'heidi.368@example.com', 57, 'Berlin', 31752.42, 'note for row 368', 0), (369, 'dave', 'dave.369@example.com', 83, 'Oslo', 76766.50, 'note for row 369', 0), (370, 'frank', 'frank.370@example.com', 38, 'Toronto', 42461.71, 'note for row 370', 1), (371, 'heidi', 'heidi.371@example.com', 52, 'Nairobi', 28330.37, 'note for row 371', 0), (372, 'alice', 'alice.372@example.com', 38, 'Lisbon', 79419.44, 'note for row 372', 1), (373, 'alice', 'alice.373@example.com', 84, 'Oslo', 57658.45, 'note for row 373', 0), (374, 'ivan', 'ivan.374@example.com', 46, 'Osaka', 54624.43, 'note for row 374', 1), (375, 'carol', 'carol.375@example.com', 43, 'Nairobi', 67864.12, 'note for row 375', 1), (376, 'erin', 'erin.376@example.com', 34, 'Oslo', 13547.00, 'note for row 376', 1), (377, 'ivan', 'ivan.377@example.com', 33, 'Austin', 52100.73, 'note for row 377', 0), (378, 'grace', 'grace.378@example.com', 53, 'Lisbon', 49749.57, 'note for row 378', 1), (379, 'erin', 'erin.379@example.com', 63, 'Nairobi', 46262.50, 'note for row 379', 1), (380, 'frank', 'frank.380@example.com', 18, 'Austin', 49895.56, 'note for row 380', 1), (381, 'carol', 'carol.381@example.com', 86, 'Nairobi', 19004.55, 'note for row 381', 1), (382, 'judy', 'judy.382@example.com', 47, 'Lisbon', 43264.41, 'note for row 382', 0), (383, 'frank', 'frank.383@example.com', 44, 'Oslo', 1401.03, 'note for row 383', 0), (384, 'erin', 'erin.384@example.com', 90, 'Austin', 39297.68, 'note for row 384', 1), (385, 'ivan', 'ivan.385@example.com', 73, 'Oslo', 51054.59, 'note for row 385', 1), (386, 'alice', 'alice.386@example.com', 62, 'Austin', 1360.86, 'note for row 386', 0), (387, 'ivan', 'ivan.387@example.com', 47, 'Lisbon', 53676.47, 'note for row 387', 1), (388, 'ivan', 'ivan.388@example.com', 37, 'Toronto', 55210.62, 'note for row 388', 1), (389, 'heidi', 'heidi.389@example.com', 61, 'Lisbon', 22376.46, 'note for row 389', 1), (390, 'frank', 'frank.390@example.com', 27, 'Nairobi', 67186.22, 'note for row 390', 0), (391, 'erin', 'erin.391@example.com', 61, 'Oslo', 82719.20, 'note for row 391', 1), (392, 'ivan', 'ivan.392@example.com', 44, 'Toronto', 54035.23, 'note for row 392', 0), (393, 'judy', 'judy.393@example.com', 31, 'Lima', 74693.80, 'note for row 393', 0), (394, 'grace', 'grace.394@example.com', 19, 'Berlin', 40205.90, 'note for row 394', 0), (395, 'erin', 'erin.395@example.com', 68, 'Lisbon', 76834.01, 'note for row 395', 0), (396, 'dave', 'dave.396@example.com', 40, 'Austin', 72515.72, 'note for row 396', 1), (397, 'ivan', 'ivan.397@example.com', 83, 'Osaka', 75296.25, 'note for row 397', 1), (398, 'judy', 'judy.398@example.com', 33, 'Osaka', 20548.66, 'note for row 398', 0), (399, 'alice', 'alice.399@example.com', 30, 'Lisbon', 22352.66, 'note for row 399', 1)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (400, 'heidi', 'heidi.400@example.com', 73, 'Berlin', 85209.01, 'note for row 400', 1), (401, 'carol', 'carol.401@example.com', 48, 'Lima', 36103.21, 'note for row 401', 0), (402, 'erin', 'erin.402@example.com', 30, 'Lisbon', 45730.24, 'note for row 402', 1), (403, 'judy', 'judy.403@example.com', 67, 'Berlin', 7166.28, 'note for row 403', 1), (404, 'judy', 'judy.404@example.com', 23, 'Austin', 7154.79, 'note for row 404', 0), (405, 'dave', 'dave.405@example.com', 46, 'Berlin', 20893.75, 'note for row 405', 0), (406, 'frank', 'frank.406@example.com', 18, 'Austin', 39803.53, 'note for row 406', 1), (407, 'heidi', 'heidi.407@example.com', 26, 'Toronto', 88772.49, 'note for row 407', 0), (408, 'grace', 'grace.408@example.com', 57, 'Oslo', 93293.62, 'note for row 408', 0), (409, 'dave', 'dave.409@example.com', 29, 'Osaka', 22272.45, 'note for row 409', 1), (410, 'carol', 'carol.410@example.com', 18, 'Nairobi', 51908.71, 'note for row 410', 1), (411, 'bob', 'bob.411@example.com', 60, 'Oslo', 44024.51, 'note for row 411', 0), (412, 'bob', 'bob.412@example.com', 72, 'Lima', 72593.31, 'note for row 412', 1), (413, 'dave', 'dave.413@example.com', 77, 'Nairobi', 45151.30, 'note for row 413', 1), (414, 'alice', 'alice.414@example.com', 53, 'Berlin', 44750.19, 'note for row 414', 0), (415, 'carol', 'carol.415@example.com', 29, 'Toronto', 35345.69, 'note for row 415', 0), (416, 'ivan', 'ivan.416@example.com', 74, 'Austin', 31481.20, 'note for row 416', 1), (417, 'frank', 'frank.417@example.com', 45, 'Oslo', 49400.80, 'note for row 417', 0), (418, 'erin', 'erin.418@example.com', 78, 'Toronto', 29789.57, 'note for row 418', 0), (419, 'erin', 'erin.419@example.com', 74, 'Lima', 70079.31, 'note for row 419', 1), (420, 'judy', 'judy.420@example.com', 83, 'Toronto', 16451.96, 'note for row 420', 0), (421, 'ivan', 'ivan.421@example.com', 29, 'Nairobi', 96460.98, 'note for row 421', 1), (422, 'alice', 'alice.422@example.com', 90, 'Osaka', 40735.01, 'note for row 422', 1), (423, 'bob', 'bob.423@example.com', 40, 'Toronto', 42078.24, 'note for row 423', 0), (424, 'bob', 'bob.424@example.com', 89, 'Lima', 65583.97, 'note for row 424', 1), (425, 'dave', 'dave.425@example.com', 26, 'Nairobi', 11526.28, 'note for row 425', 1), (426, 'carol', 'carol.426@example.com', 69, 'Nairobi', 46648.51, 'note for row 426', 1), (427, 'carol', 'carol.427@example.com', 53, 'Osaka', 3876.46, 'note for row 427', 1), (428, 'grace', 'grace.428@example.com', 21, 'Austin', 32561.51, 'note for row 428', 1), (429, 'bob', 'bob.429@example.com', 41, 'Nairobi', 15103.34, 'note for row 429', 0), (430, 'alice', 'alice.430@example.com', 69, 'Berlin', 79761.20, 'note for row 430', 1), (431, 'dave', 'dave.431@example.com', 56, 'Osaka', 49904.94, 'note for row 431', 0), (432, 'ivan', 'ivan.432@example.com', 57, 'Osaka', 73996.29, 'note for row 432', 1), (433, 'ivan', 'ivan.433@example.com', 50, 'Oslo', 87835.87, 'note for row 433', 1), (434, 'alice', 'alice.434@example.com', 32, 'Nairobi', 5630.74, 'note for row 434', 0), (435, 'dave', 'dave.435@example.com', 32, 'Berlin', 41753.26, 'note for row 435', 1), (436, 'bob', 'bob.436@example.com', 71, 'Oslo', 97984.78, 'note for row 436', 0), (437, 'erin', 'erin.437@example.com', 85, 'Lisbon', 45748.54, 'note for row 437', 1), (438, 'frank', 'frank.438@example.com', 82, 'Austin', 66670.06, 'note for row 438', 0), (439, 'grace', 'grace.439@example.com', 83, 'Osaka', 64161.97, 'note for row 439', 0), (440, 'alice', 'alice.440@example.com', 89, 'Nairobi', 22876.69, 'note for row 440', 0), (441, 'dave', 'dave.441@example.com', 87, 'Nairobi', 32727.07, 'note for row 441', 0), (442, 'frank', 'frank.442@example.com', 62, 'Oslo', 12129.25, 'note for row 442', 1), (443, 'carol', 'carol.443@example.com', 35, 'Austin', 87862.61, 'note for row 443', 0), (444, 'dave', 'dave.444@example.com', 18, 'Austin', 17445.82, 'note for row 444', 1), (445, 'erin', 'erin.445@example.com', 35, 'Osaka', 77011.72, 'note for row 445', 0), (446, 'frank', 'frank.446@example.com', 33, 'Oslo', 99682.21, 'note for row 446', 0), (447, 'judy', 'judy.447@example.com', 77, 'Oslo', 27043.14, 'note for row 447', 1), (448, 'alice', 'alice.448@example.com', 64, 'Austin', 27057.05, 'note for row 448', 0), (449, 'erin', 'erin.449@example.com', 56, 'Toronto', 14495.89, 'note for row 449', 1)
+INSERT INTO users (id, name, email, age, city, balance, note, active) VALUES (450, 'heidi', 'heidi.450@example.com', 32, 'Osaka', 42529.56, 'note for row 450', 1), (451, 'judy', 'judy.451@example.com', 64, 'Nairobi', 22032.71, 'note for row 451', 0), (452, 'alice', 'alice.452@example.com', 19, 'Austin', 98362.62, 'note for row 452', 0), (453, 'frank', 'frank.453@example.com', 90, 'Nairobi', 14260.82, 'note for row 453', 1), (454, 'grace', 'grace.454@example.com', 80, 'Toronto', 71181.41, 'note for row 454', 0), (455, 'frank', 'frank.455@example.com', 29, 'Nairobi', 82279.78, 'note for row 455', 1), (456, 'dave', 'dave.456@example.com', 28, 'Osaka', 97969.03, 'note for row 456', 0), (457, 'grace', 'grace.457@example.com', 36, 'Nairobi', 48219.23, 'note for row 457', 0), (458, 'bob', 'bob.458@example.com', 57, 'Lima', 49725.23, 'note for row 458', 1), (459, 'frank', 'frank.459@example.com', 47, 'Lima', 17870.70, 'note for row 459', 1), (460, 'erin', 'erin.460@example.com', 48, 'Berlin', 5407.13, 'note for row 460', 1), (461, 'alice', 'alice.461@example.com', 45, 'Austin', 55440.63, 'note for row 461', 0), (462, 'erin', 'erin.462@example.com', 28, 'Osaka', 90175.29, 'note for row 462', 0), (463, 'carol', 'carol.463@example.com', 74, 'Oslo', 11752.05, 'note for row 463', 1), (464, 'heidi', 'heidi.464@example.com', 42, 'Toronto', 94758.47, 'note for row 464', 0), (465, 'alice', 'alice.465@example.com', 83, 'Oslo', 18764.36, 'note for row 465', 0), (466, 'alice', 'alice.466@example.com', 83, 'Oslo', 44389.08, 'note for row 466', 1), (467, 'alice', 'alice.467@example.com', 40, 'Osaka', 49653.37, 'note for row 467', 0), (468, 'heidi', 'heidi.468@example.com', 90, 'Lima', 74385.25, 'note for row 468', 1), (469, 'bob', 'bob.469@example.com', 87, 'Lima', 67735.58, 'note for row 469', 1), (470, 'ivan', 'ivan.470@example.com', 37, 'Oslo', 79832.79, 'note for row 470', 0), (471, 'alice', 'alice.471@example.com', 60, 'Nairobi', 74058.73, 'note for row 471', 1), (472, 'frank', 'frank.472@example.com', 79, 'Osaka', 39231.43, 'note for row 472', 0), (473, 'dave', 'dave.473@example.com', 46, 'Austin', 90617.10, 'note for row 473', 0), (474, 'judy', 'judy.474@example.com', 65, 'Oslo', 47186.67, 'note for row 474', 0), (475, 'judy', 'judy.475@example.com', 74, 'Oslo', 34220.14, 'note for row 475', 0), (476, 'carol', 'carol.476@example.com', 43, 'Lisbon', 29000.32, 'note for row 476', 0), (477, 'dave', 'dave.477@example.com', 85, 'Nairobi', 92942.62, 'note for row 477', 0), (478, 'ivan', 'ivan.478@example.com', 76, 'Toronto', 70939.73, 'note for row 478', 0), (479, 'ivan', 'ivan.479@example.com', 90, 'Lisbon', 53480.86, 'note for row 479', 0), (480, 'heidi', 'heidi.480@example.com', 35, 'Lisbon', 82129.92, 'note for row 480', 0), (481, 'heidi', 'heidi.481@example.com', 68, 'Osaka', 25119.72, 'note for row 481', 1), (482, 'bob', 'bob.482@example.com', 35, 'Lima', 81105.07, 'note for row 482', 1), (483, 'dave', 'dave.483@example.com', 24, 'Lima', 5470.01, 'note for row 483', 0), (484, 'heidi', 'heidi.484@example.com', 56, 'Lisbon', 92723.17, 'note for row 484', 1), (485, 'bob', 'bob.485@example.com', 43, 'Lisbon', 95448.45, 'note for row 485', 0), (486, 'frank', 'frank.486@example.com', 61, 'Berlin', 33504.15, 'note for row 486', 0), (487, 'frank', 'frank.487@example.com', 83, 'Lima', 94605.62, 'note for row 487', 0), (488, 'judy', 'judy.488@example.com', 63, 'Lisbon', 46627.70, 'note for row 488', 1), (489, 'judy', 'judy.489@example.com', 32, 'Berlin', 88502.31, 'note for row 489', 1), (490, 'frank', 'frank.490@example.com', 42, 'Austin', 2789.74, 'note for row 490', 1), (491, 'bob', 'bob.491@example.com', 20, 'Austin', 14472.09, 'note for row 491', 1), (492, 'carol', 'carol.492@example.com', 37, 'Nairobi', 90067.85, 'note for row 492', 1), (493, 'carol', 'carol.493@example.com', 50, 'Nairobi', 58207.01, 'note for row 493', 0), (494, 'frank', 'frank.494@example.com', 37, 'Austin', 65768.61, 'note for row 494', 0), (495, 'alice', 'alice.495@example.com', 27, 'Osaka', 81319.82, 'note for row 495', 1), (496, 'heidi', 'heidi.496@example.com', 38, 'Austin', 51565.29, 'note for row 496', 0), (497, 'frank', 'frank.497@example.com', 60, 'Toronto', 40797.16, 'note for row 497', 0), (498, 'dave', 'dave.498@example.com', 39, 'Lima', 95321.59, 'note for row 498', 1), (499, 'judy', 'judy.499@example.com', 77, 'Oslo', 46357.40, 'note for row 499', 0)
+
+-- @category update_many_set
+UPDATE metrics SET c0 = 'frank', c1 = 593, c2 = 'heidi', c3 = 341, c4 = 'dave', c5 = 21, c6 = 'dave', c7 = 470, c8 = 'judy', c9 = 46, c10 = 'carol', c11 = 744 WHERE id = 87946
+UPDATE metrics SET c0 = 'carol', c1 = 279, c2 = 'grace', c3 = 279, c4 = 'bob', c5 = 512, c6 = 'erin', c7 = 365, c8 = 'judy', c9 = 587, c10 = 'ivan', c11 = 598 WHERE id = 18232
+UPDATE metrics SET c0 = 'alice', c1 = 937, c2 = 'ivan', c3 = 924, c4 = 'bob', c5 = 893, c6 = 'dave', c7 = 792, c8 = 'grace', c9 = 648, c10 = 'judy', c11 = 649 WHERE id = 12976
+UPDATE metrics SET c0 = 'frank', c1 = 810, c2 = 'erin', c3 = 812, c4 = 'dave', c5 = 893, c6 = 'carol', c7 = 697, c8 = 'bob', c9 = 311, c10 = 'frank', c11 = 757 WHERE id = 47534
+UPDATE metrics SET c0 = 'ivan', c1 = 873, c2 = 'dave', c3 = 358, c4 = 'ivan', c5 = 732, c6 = 'grace', c7 = 342, c8 = 'alice', c9 = 721, c10 = 'frank', c11 = 687 WHERE id = 42363
+UPDATE metrics SET c0 = 'heidi', c1 = 515, c2 = 'frank', c3 = 915, c4 = 'dave', c5 = 828, c6 = 'dave', c7 = 357, c8 = 'carol', c9 = 138, c10 = 'dave', c11 = 7 WHERE id = 88002
+UPDATE metrics SET c0 = 'heidi', c1 = 414, c2 = 'heidi', c3 = 405, c4 = 'judy', c5 = 790, c6 = 'erin', c7 = 951, c8 = 'carol', c9 = 600, c10 = 'bob', c11 = 147 WHERE id = 39517
+UPDATE metrics SET c0 = 'erin', c1 = 258, c2 = 'judy', c3 = 564, c4 = 'frank', c5 = 75, c6 = 'dave', c7 = 597, c8 = 'bob', c9 = 598, c10 = 'carol', c11 = 311 WHERE id = 76085
+UPDATE metrics SET c0 = 'frank', c1 = 479, c2 = 'frank', c3 = 993, c4 = 'grace', c5 = 738, c6 = 'bob', c7 = 858, c8 = 'heidi', c9 = 326, c10 = 'carol', c11 = 282 WHERE id = 33757
+UPDATE metrics SET c0 = 'ivan', c1 = 23, c2 = 'carol', c3 = 641, c4 = 'erin', c5 = 242, c6 = 'alice', c7 = 223, c8 = 'alice', c9 = 409, c10 = 'heidi', c11 = 205 WHERE id = 79024
+UPDATE metrics SET c0 = 'erin', c1 = 884, c2 = 'ivan', c3 = 663, c4 = 'bob', c5 = 201, c6 = 'dave', c7 = 751, c8 = 'alice', c9 = 986, c10 = 'carol', c11 = 615 WHERE id = 6371
+UPDATE metrics SET c0 = 'bob', c1 = 75, c2 = 'judy', c3 = 349, c4 = 'carol', c5 = 5, c6 = 'dave', c7 = 277, c8 = 'ivan', c9 = 657, c10 = 'alice', c11 = 655 WHERE id = 42323
+UPDATE metrics SET c0 = 'alice', c1 = 217, c2 = 'frank', c3 = 334, c4 = 'alice', c5 = 664, c6 = 'heidi', c7 = 415, c8 = 'judy', c9 = 695, c10 = 'frank', c11 = 178 WHERE id = 7530
+UPDATE metrics SET c0 = 'grace', c1 = 815, c2 = 'alice', c3 = 89, c4 = 'judy', c5 = 342, c6 = 'heidi', c7 = 612, c8 = 'grace', c9 = 263, c10 = 'heidi', c11 = 894 WHERE id = 1783
+UPDATE metrics SET c0 = 'alice', c1 = 947, c2 = 'frank', c3 = 577, c4 = 'frank', c5 = 57, c6 = 'grace', c7 = 628, c8 = 'frank', c9 = 160, c10 = 'bob', c11 = 19 WHERE id = 20473
+UPDATE metrics SET c0 = 'dave', c1 = 146, c2 = 'ivan', c3 = 785, c4 = 'bob', c5 = 366, c6 = 'frank', c7 = 433, c8 = 'frank', c9 = 551, c10 = 'judy', c11 = 886 WHERE id = 72745
+UPDATE metrics SET c0 = 'carol', c1 = 673, c2 = 'judy', c3 = 588, c4 = 'frank', c5 = 235, c6 = 'judy', c7 = 264, c8 = 'heidi', c9 = 781, c10 = 'alice', c11 = 794 WHERE id = 84844
+UPDATE metrics SET c0 = 'erin', c1 = 667, c2 = 'ivan', c3 = 1000, c4 = 'heidi', c5 = 572, c6 = 'erin', c7 = 370, c8 = 'ivan', c9 = 542, c10 = 'erin', c11 = 135 WHERE id = 33151
+UPDATE metrics SET c0 = 'alice', c1 = 571, c2 = 'heidi', c3 = 102, c4 = 'frank', c5 = 154, c6 = 'dave', c7 = 410, c8 = 'bob', c9 = 959, c10 = 'alice', c11 = 639 WHERE id = 17583
+UPDATE metrics SET c0 = 'bob', c1 = 61, c2 = 'ivan', c3 = 513, c4 = 'dave', c5 = 568, c6 = 'carol', c7 = 265, c8 = 'judy', c9 = 374, c10 = 'carol', c11 = 924 WHERE id = 23257
+UPDATE metrics SET c0 = 'carol', c1 = 541, c2 = 'alice', c3 = 359, c4 = 'dave', c5 = 452, c6 = 'heidi', c7 = 218, c8 = 'frank', c9 = 922, c10 = 'grace', c11 = 471 WHERE id = 27800
+UPDATE metrics SET c0 = 'frank', c1 = 808, c2 = 'alice', c3 = 110, c4 = 'alice', c5 = 67, c6 = 'grace', c7 = 690, c8 = 'frank', c9 = 61, c10 = 'dave', c11 = 577 WHERE id = 49283
+UPDATE metrics SET c0 = 'grace', c1 = 928, c2 = 'grace', c3 = 967, c4 = 'dave', c5 = 31, c6 = 'erin', c7 = 21, c8 = 'erin', c9 = 726, c10 = 'grace', c11 = 247 WHERE id = 30328
+UPDATE metrics SET c0 = 'frank', c1 = 208, c2 = 'frank', c3 = 777, c4 = 'grace', c5 = 658, c6 = 'erin', c7 = 305, c8 = 'heidi', c9 = 221, c10 = 'judy', c11 = 809 WHERE id = 20543
+UPDATE metrics SET c0 = 'heidi', c1 = 883, c2 = 'erin', c3 = 977, c4 = 'carol', c5 = 842, c6 = 'erin', c7 = 289, c8 = 'bob', c9 = 339, c10 = 'alice', c11 = 497 WHERE id = 32733
+UPDATE metrics SET c0 = 'carol', c1 = 327, c2 = 'judy', c3 = 611, c4 = 'heidi', c5 = 217, c6 = 'judy', c7 = 53, c8 = 'dave', c9 = 871, c10 = 'frank', c11 = 47 WHERE id = 57551
+UPDATE metrics SET c0 = 'carol', c1 = 445, c2 = 'carol', c3 = 958, c4 = 'erin', c5 = 701, c6 = 'alice', c7 = 824, c8 = 'bob', c9 = 155, c10 = 'alice', c11 = 136 WHERE id = 39677
+UPDATE metrics SET c0 = 'carol', c1 = 514, c2 = 'frank', c3 = 99, c4 = 'carol', c5 = 475, c6 = 'grace', c7 = 92, c8 = 'grace', c9 = 347, c10 = 'grace', c11 = 903 WHERE id = 43997
+UPDATE metrics SET c0 = 'alice', c1 = 599, c2 = 'dave', c3 = 206, c4 = 'alice', c5 = 38, c6 = 'carol', c7 = 516, c8 = 'judy', c9 = 237, c10 = 'judy', c11 = 440 WHERE id = 91544
+UPDATE metrics SET c0 = 'bob', c1 = 745, c2 = 'alice', c3 = 49, c4 = 'frank', c5 = 66, c6 = 'bob', c7 = 123, c8 = 'heidi', c9 = 993, c10 = 'carol', c11 = 538 WHERE id = 56162
+
+-- @category delete
+DELETE FROM orders WHERE customer_id = 22 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 1467 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 1835 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 4428 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 1212 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 4469 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 4102 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 921 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 4342 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 2897 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 4066 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 634 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 2863 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 1763 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 1835 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 594 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 2237 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 1452 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 125 AND status != 'open'
+DELETE FROM orders WHERE customer_id = 2168 AND status != 'open'
+
+-- @category ddl
+CREATE TABLE t0 (id INT PRIMARY KEY, col0 TEXT NOT NULL, col1 INT, col2 INT, col3 INT NOT NULL, col4 FLOAT, col5 INT, col6 TEXT NOT NULL, col7 FLOAT, col8 TEXT, col9 TEXT NOT NULL)
+DROP TABLE t0
+CREATE TABLE t1 (id INT PRIMARY KEY, col0 INT NOT NULL, col1 TEXT, col2 FLOAT, col3 INT NOT NULL, col4 FLOAT, col5 TEXT, col6 FLOAT NOT NULL, col7 TEXT, col8 FLOAT, col9 TEXT NOT NULL)
+DROP TABLE t1
+CREATE TABLE t2 (id INT PRIMARY KEY, col0 FLOAT NOT NULL, col1 TEXT, col2 FLOAT, col3 FLOAT NOT NULL, col4 TEXT, col5 TEXT, col6 TEXT NOT NULL, col7 TEXT, col8 FLOAT, col9 TEXT NOT NULL)
+DROP TABLE t2
+CREATE TABLE t3 (id INT PRIMARY KEY, col0 TEXT NOT NULL, col1 INT, col2 TEXT, col3 TEXT NOT NULL, col4 TEXT, col5 INT, col6 FLOAT NOT NULL, col7 INT, col8 INT, col9 FLOAT NOT NULL)
+DROP TABLE t3
+CREATE TABLE t4 (id INT PRIMARY KEY, col0 FLOAT NOT NULL, col1 TEXT, col2 FLOAT, col3 FLOAT NOT NULL, col4 FLOAT, col5 TEXT, col6 INT NOT NULL, col7 INT, col8 FLOAT, col9 INT NOT NULL)
+DROP TABLE t4
+CREATE TABLE t5 (id INT PRIMARY KEY, col0 INT NOT NULL, col1 FLOAT, col2 INT, col3 FLOAT NOT NULL, col4 INT, col5 TEXT, col6 FLOAT NOT NULL, col7 FLOAT, col8 TEXT, col9 FLOAT NOT NULL)
+DROP TABLE t5
+CREATE TABLE t6 (id INT PRIMARY KEY, col0 FLOAT NOT NULL, col1 TEXT, col2 FLOAT, col3 FLOAT NOT NULL, col4 TEXT, col5 TEXT, col6 FLOAT NOT NULL, col7 INT, col8 TEXT, col9 FLOAT NOT NULL)
+DROP TABLE t6
+CREATE TABLE t7 (id INT PRIMARY KEY, col0 FLOAT NOT NULL, col1 TEXT, col2 FLOAT, col3 TEXT NOT NULL, col4 FLOAT, col5 FLOAT, col6 TEXT NOT NULL, col7 INT, col8 FLOAT, col9 FLOAT NOT NULL)
+DROP TABLE t7
+CREATE TABLE t8 (id INT PRIMARY KEY, col0 TEXT NOT NULL, col1 TEXT, col2 FLOAT, col3 INT NOT NULL, col4 TEXT, col5 FLOAT, col6 TEXT NOT NULL, col7 FLOAT, col8 FLOAT, col9 FLOAT NOT NULL)
+DROP TABLE t8
+CREATE TABLE t9 (id INT PRIMARY KEY, col0 TEXT NOT NULL, col1 INT, col2 FLOAT, col3 FLOAT NOT NULL, col4 FLOAT, col5 INT, col6 FLOAT NOT NULL, col7 TEXT, col8 TEXT, col9 TEXT NOT NULL)
+DROP TABLE t9
@@ -0,0 +1,159 @@
+// Microbenchmarks comparing storage::BPlusTree with storage::AdaptiveRadixTree
+//
+// Both trees are driven through their common interface (insert, find,
+// scan_from) on the key shapes db::Table produces: dense integer keys as
+// YCSB loads them, sparse 64-bit integers, and "user%012d" text keys.
+// Select one structure or key shape with --benchmark_filter, e.g.
+// --benchmark_filter='BM_Find<Art'.
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+#include "../include/storage/bplustree.h"
+#include "../include/storage/art.h"
+#include "../include/db/table.h"
+
+using toydb::db::DBInt;
+using toydb::db::DBText;
+
+namespace {
+
+// Key shapes
+struct Dense {
+    using Key = DBInt;
+    static Key make(uint64_t i) { return static_cast<Key>(i); }
+};
+
+struct Sparse {
+    using Key = DBInt;
+    static Key make(uint64_t i) {
+        // A bijective mix of i, so keys stay unique but spread over 64 bits
+        uint64_t h = i * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 29;
+        return static_cast<Key>(h);
+    }
+};
+
+struct Text {
+    using Key = DBText;
+    static Key make(uint64_t i) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "user%012llu", static_cast<unsigned long long>(i));
+        return buffer;
+    }
+};
+
+// Structures under test; Order 64 is what secondary B+ tree indexes use
+template<typename Shape>
+using BTree = toydb::storage::BPlusTree<typename Shape::Key, size_t, 64>;
+
+template<typename Shape>
+using Art = toydb::storage::AdaptiveRadixTree<typename Shape::Key, size_t>;
+
+template<typename Shape>
+std::vector<typename Shape::Key> make_keys(size_t count, uint64_t first = 0) {
+    std::vector<typename Shape::Key> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys.push_back(Shape::make(first + i));
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    return keys;
+}
+
+template<typename Tree, typename Keys>
+void fill(Tree& tree, const Keys& keys) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+        tree.insert(keys[i], i);
+    }
+}
+
+// Build a whole structure of state.range(0) keys in random order per iteration
+template<template<typename> class Tree, typename Shape>
+void BM_Insert(benchmark::State& state) {
+    auto keys = make_keys<Shape>(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Tree<Shape> tree;
+        fill(tree, keys);
+        benchmark::DoNotOptimize(tree);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// One point lookup of an existing key per iteration
+template<template<typename> class Tree, typename Shape>
+void BM_Find(benchmark::State& state) {
+    auto keys = make_keys<Shape>(static_cast<size_t>(state.range(0)));
+    Tree<Shape> tree;
+    fill(tree, keys);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tree.find(keys[i]));
+        if (++i == keys.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// One point lookup of an absent key per iteration
+template<template<typename> class Tree, typename Shape>
+void BM_FindMissing(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    Tree<Shape> tree;
+    fill(tree, make_keys<Shape>(count));
+    auto missing = make_keys<Shape>(count, count);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tree.find(missing[i]));
+        if (++i == missing.size()) i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Visit 100 consecutive keys from a random existing key per iteration
+template<template<typename> class Tree, typename Shape>
+void BM_Scan(benchmark::State& state) {
+    constexpr size_t kScanLength = 100;
+    auto keys = make_keys<Shape>(static_cast<size_t>(state.range(0)));
+    Tree<Shape> tree;
+    fill(tree, keys);
+
+    size_t i = 0;
+    size_t visited = 0;
+    for (auto _ : state) {
+        size_t n = 0;
+        tree.scan_from(keys[i], [&](const typename Shape::Key&, const size_t& value) {
+            visited += value & 1;
+            return ++n < kScanLength;
+        });
+        if (++i == keys.size()) i = 0;
+    }
+    benchmark::DoNotOptimize(visited);
+    state.SetItemsProcessed(state.iterations() * kScanLength);
+}
+
+} // namespace
+
+// Sizes from 4K to 256K keys
+#define TOYDB_INDEX_SIZES RangeMultiplier(8)->Range(1 << 12, 1 << 18)
+
+#define TOYDB_INDEX_BENCHMARKS(Tree, Shape)                                  \
+    BENCHMARK_TEMPLATE(BM_Insert, Tree, Shape)->TOYDB_INDEX_SIZES;           \
+    BENCHMARK_TEMPLATE(BM_Find, Tree, Shape)->TOYDB_INDEX_SIZES;             \
+    BENCHMARK_TEMPLATE(BM_FindMissing, Tree, Shape)->TOYDB_INDEX_SIZES;      \
+    BENCHMARK_TEMPLATE(BM_Scan, Tree, Shape)->TOYDB_INDEX_SIZES
+
+TOYDB_INDEX_BENCHMARKS(BTree, Dense);
+TOYDB_INDEX_BENCHMARKS(Art, Dense);
+TOYDB_INDEX_BENCHMARKS(BTree, Sparse);
+TOYDB_INDEX_BENCHMARKS(Art, Sparse);
+TOYDB_INDEX_BENCHMARKS(BTree, Text);
+TOYDB_INDEX_BENCHMARKS(Art, Text);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,194 @@
+// Parser throughput benchmark
+//
+// Parses every statement of a SQL corpus repeatedly and reports, per corpus
+// category, statements per second and heap allocations per statement.
+// Allocations are counted by replacing the global operator new.
+//
+// Usage: toydb_parser_bench [--corpus PATH] [--seconds N]
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <new>
+#include <cstdlib>
+#include <cstdint>
+#include "../include/parser/parser.h"
+
+#ifndef TOYDB_PARSER_CORPUS
+#define TOYDB_PARSER_CORPUS "bench/corpus/parser.sql"
+#endif
+
+namespace {
+
+uint64_t g_allocations = 0;
+uint64_t g_allocated_bytes = 0;
+
+} // namespace
+
+// Allocation counting (the benchmark is single-threaded)
+void* operator new(std::size_t size) {
+    g_allocations++;
+    g_allocated_bytes += size;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Category {
+    std::string name;
+    std::vector<std::string> statements;
+};
+
+// Lines starting with "-- @category NAME" open a category; other comment and
+// blank lines are skipped
+bool load_corpus(const std::string& path, std::vector<Category>& categories) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Cannot open corpus: " << path << std::endl;
+        return false;
+    }
+
+    const std::string marker = "-- @category ";
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.compare(0, marker.size(), marker) == 0) {
+            categories.push_back({line.substr(marker.size()), {}});
+        } else if (!line.empty() && line.compare(0, 2, "--") != 0) {
+            if (categories.empty()) {
+                categories.push_back({"default", {}});
+            }
+            categories.back().statements.push_back(line);
+        }
+    }
+    return true;
+}
+
+struct Result {
+    uint64_t statements = 0;
+    uint64_t bytes = 0;         // SQL text parsed
+    uint64_t allocations = 0;
+    uint64_t allocated_bytes = 0;
+    double seconds = 0.0;
+};
+
+Result run_category(const Category& category, double seconds) {
+    toydb::parser::Parser parser;
+    Result result;
+
+    // Warm up and check that the whole category parses
+    for (const auto& sql : category.statements) {
+        if (!parser.parse(sql)) {
+            std::cerr << "Corpus statement does not parse (" << parser.last_error()
+                      << "): " << sql.substr(0, 80) << std::endl;
+        }
+    }
+
+    uint64_t allocations_before = g_allocations;
+    uint64_t bytes_before = g_allocated_bytes;
+    auto start = Clock::now();
+    auto deadline = start + std::chrono::duration<double>(seconds);
+
+    do {
+        for (const auto& sql : category.statements) {
+            auto statement = parser.parse(sql);
+            result.bytes += sql.size();
+            (void)statement;
+        }
+        result.statements += category.statements.size();
+    } while (Clock::now() < deadline);
+
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    result.allocations = g_allocations - allocations_before;
+    result.allocated_bytes = g_allocated_bytes - bytes_before;
+    return result;
+}
+
+void print_row(const std::string& name, const Result& result) {
+    double statements = static_cast<double>(result.statements);
+    std::cout << std::left << std::setw(18) << name << std::right
+              << std::setw(14) << std::setprecision(0) << statements / result.seconds
+              << std::setw(12) << std::setprecision(1)
+              << result.seconds * 1e9 / statements
+              << std::setw(11) << std::setprecision(1)
+              << static_cast<double>(result.bytes) / result.seconds / (1024 * 1024)
+              << std::setw(14) << static_cast<double>(result.allocations) / statements
+              << std::setw(16) << std::setprecision(0)
+              << static_cast<double>(result.allocated_bytes) / statements << "\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string corpus_path = TOYDB_PARSER_CORPUS;
+    double seconds = 1.0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--corpus" && i + 1 < argc) {
+            corpus_path = argv[++i];
+        } else if (arg == "--seconds" && i + 1 < argc) {
+            seconds = std::atof(argv[++i]);
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Category> categories;
+    if (!load_corpus(corpus_path, categories)) {
+        return 1;
+    }
+
+    std::cout << std::fixed
+              << std::left << std::setw(18) << "category" << std::right
+              << std::setw(14) << "stmts/sec" << std::setw(12) << "ns/stmt"
+              << std::setw(11) << "MiB/sec" << std::setw(14) << "allocs/stmt"
+              << std::setw(16) << "alloc B/stmt" << "\n";
+
+    Result total;
+    for (const auto& category : categories) {
+        if (category.statements.empty()) continue;
+
+        Result result = run_category(category, seconds);
+        print_row(category.name, result);
+
+        total.statements += result.statements;
+        total.bytes += result.bytes;
+        total.allocations += result.allocations;
+        total.allocated_bytes += result.allocated_bytes;
+        total.seconds += result.seconds;
+    }
+
+    if (total.statements > 0) {
+        print_row("total", total);
+    }
+    return 0;
+}
@@ -0,0 +1,652 @@
+// TPC-C-lite transactional benchmark
+//
+// A scaled-down driver inspired by TPC-C. It creates the warehouse,
+// district, customer, item, stock, orders, new_order and order_line tables
+// through db::Database, loads them for the requested number of warehouses
+// and runs concurrent clients issuing the New-Order (45%), Payment (43%)
+// and Order-Status (12%) transactions between BEGIN and COMMIT/ABORT.
+//
+// Differences from the specification:
+//   - Composite keys are packed into a single INT primary key
+//   - Item and customer counts are configurable and default to a tenth of
+//     the specified cardinalities; no orders are preloaded
+//   - There is no think or keying time
+//   - The engine has no undo, so transactions make their first write a
+//     conditional update and abort before writing anything if it fails
+//     (a concurrent client got there first) or if an item is invalid
+//     (the 1% rollback rule of New-Order)
+//
+// Usage: toydb_tpcc [--warehouses N] [--clients N] [--duration SECONDS]
+//                   [--items N] [--customers N] [--seed N]
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include "../include/db/database.h"
+
+using namespace toydb;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int64_t kDistrictsPerWarehouse = 10;
+constexpr int64_t kMinOrderLines = 5;
+constexpr int64_t kMaxOrderLines = 15;
+
+struct Options {
+    int64_t warehouses = 1;
+    size_t clients = 4;
+    double duration = 10.0;
+    int64_t items = 10000;      // Per the specification: 100000
+    int64_t customers = 300;    // Per district; the specification has 3000
+    uint64_t seed = 42;
+};
+
+// Packed primary keys
+int64_t district_key(int64_t w, int64_t d) { return w * kDistrictsPerWarehouse + d; }
+int64_t customer_key(int64_t d_key, int64_t c) { return d_key * 100000 + c; }
+int64_t stock_key(int64_t w, int64_t i) { return w * 1000000 + i; }
+int64_t order_key(int64_t d_key, int64_t o) { return d_key * 10000000 + o; }
+int64_t order_line_key(int64_t o_key, int64_t n) { return o_key * 16 + n; }
+
+// Column positions used by the transactions
+enum WarehouseColumn { W_ID, W_NAME, W_TAX, W_YTD };
+enum DistrictColumn { D_KEY, D_W_ID, D_ID, D_NAME, D_TAX, D_YTD, D_NEXT_O_ID };
+enum CustomerColumn {
+    C_KEY, C_W_ID, C_D_ID, C_ID, C_FIRST, C_LAST, C_CREDIT, C_DISCOUNT,
+    C_BALANCE, C_YTD_PAYMENT, C_PAYMENT_CNT
+};
+enum ItemColumn { I_ID, I_NAME, I_PRICE, I_DATA };
+enum StockColumn { S_KEY, S_W_ID, S_I_ID, S_QUANTITY, S_YTD, S_ORDER_CNT, S_DATA };
+enum OrderColumn { O_KEY, O_D_KEY, O_ID, O_C_KEY, O_ENTRY_D, O_OL_CNT, O_ALL_LOCAL };
+
+db::ColumnDef int_column(const std::string& name, bool primary_key = false) {
+    return {name, db::ColumnType::Int, primary_key, true};
+}
+db::ColumnDef float_column(const std::string& name) {
+    return {name, db::ColumnType::Float, false, true};
+}
+db::ColumnDef text_column(const std::string& name) {
+    return {name, db::ColumnType::Text, false, false};
+}
+
+void create_schema(db::Database& database) {
+    database.create_table("warehouse", {
+        int_column("w_id", true), text_column("w_name"), float_column("w_tax"),
+        float_column("w_ytd")});
+    database.create_table("district", {
+        int_column("d_key", true), int_column("d_w_id"), int_column("d_id"),
+        text_column("d_name"), float_column("d_tax"), float_column("d_ytd"),
+        int_column("d_next_o_id")});
+    database.create_table("customer", {
+        int_column("c_key", true), int_column("c_w_id"), int_column("c_d_id"),
+        int_column("c_id"), text_column("c_first"), text_column("c_last"),
+        text_column("c_credit"), float_column("c_discount"), float_column("c_balance"),
+        float_column("c_ytd_payment"), int_column("c_payment_cnt")});
+    database.create_table("item", {
+        int_column("i_id", true), text_column("i_name"), float_column("i_price"),
+        text_column("i_data")});
+    database.create_table("stock", {
+        int_column("s_key", true), int_column("s_w_id"), int_column("s_i_id"),
+        int_column("s_quantity"), int_column("s_ytd"), int_column("s_order_cnt"),
+        text_column("s_data")});
+    database.create_table("orders", {
+        int_column("o_key", true), int_column("o_d_key"), int_column("o_id"),
+        int_column("o_c_key"), int_column("o_entry_d"), int_column("o_ol_cnt"),
+        int_column("o_all_local")});
+    database.create_table("new_order", {
+        int_column("no_key", true), int_column("no_d_key")});
+    database.create_table("order_line", {
+        int_column("ol_key", true), int_column("ol_o_key"), int_column("ol_number"),
+        int_column("ol_i_id"), int_column("ol_supply_w_id"), int_column("ol_quantity"),
+        float_column("ol_amount")});
+}
+
+class Random {
+public:
+    explicit Random(uint64_t seed) : rng_(seed) {}
+
+    int64_t uniform(int64_t low, int64_t high) {
+        return std::uniform_int_distribution<int64_t>(low, high)(rng_);
+    }
+
+    double uniform_real(double low, double high) {
+        return std::uniform_real_distribution<double>(low, high)(rng_);
+    }
+
+    // Non-uniform random from clause 2.1.6 of the specification
+    int64_t nurand(int64_t a, int64_t c, int64_t low, int64_t high) {
+        return (((uniform(0, a) | uniform(low, high)) + c) % (high - low + 1)) + low;
+    }
+
+    std::string text(size_t min_length, size_t max_length) {
+        size_t length = static_cast<size_t>(uniform(static_cast<int64_t>(min_length),
+                                                     static_cast<int64_t>(max_length)));
+        std::string s(length, ' ');
+        for (auto& c : s) {
+            c = static_cast<char>('a' + uniform(0, 25));
+        }
+        return s;
+    }
+
+private:
+    std::mt19937_64 rng_;
+};
+
+// Customer last names are built from three syllables (clause 4.3.2.3)
+std::string last_name(int64_t number) {
+    static const char* kSyllables[] = {
+        "BAR", "OUGHT", "ABLE", "PRI", "PRES", "ESE", "ANTI", "CALLY", "ATION", "EING"};
+    return std::string(kSyllables[(number / 100) % 10]) + kSyllables[(number / 10) % 10] +
+           kSyllables[number % 10];
+}
+
+void load(db::Database& database, const Options& options) {
+    Random random(options.seed);
+
+    auto item = database.get_table("item");
+    for (int64_t i = 0; i < options.items; ++i) {
+        item->insert_row({i, random.text(14, 24), random.uniform_real(1.0, 100.0),
+                          random.text(26, 50)});
+    }
+
+    auto warehouse = database.get_table("warehouse");
+    auto district = database.get_table("district");
+    auto customer = database.get_table("customer");
+    auto stock = database.get_table("stock");
+
+    for (int64_t w = 0; w < options.warehouses; ++w) {
+        warehouse->insert_row({w, random.text(6, 10), random.uniform_real(0.0, 0.2),
+                               300000.0});
+
+        for (int64_t i = 0; i < options.items; ++i) {
+            stock->insert_row({stock_key(w, i), w, i, random.uniform(10, 100),
+                               int64_t{0}, int64_t{0}, random.text(26, 50)});
+        }
+
+        for (int64_t d = 0; d < kDistrictsPerWarehouse; ++d) {
+            int64_t d_key = district_key(w, d);
+            district->insert_row({d_key, w, d, random.text(6, 10),
+                                  random.uniform_real(0.0, 0.2), 30000.0, int64_t{1}});
+
+            for (int64_t c = 0; c < options.customers; ++c) {
+                int64_t name = c < 1000 ? c : random.nurand(255, 0, 0, 999);
+                customer->insert_row({customer_key(d_key, c), w, d, c, random.text(8, 16),
+                                      last_name(name),
+                                      std::string(random.uniform(0, 9) == 0 ? "BC" : "GC"),
+                                      random.uniform_real(0.0, 0.5), -10.0, 10.0,
+                                      int64_t{1}});
+            }
+        }
+    }
+}
+
+enum TxnType { NewOrder, Payment, OrderStatus, TxnTypeCount };
+
+const char* txn_name(int type) {
+    switch (type) {
+        case NewOrder: return "New-Order";
+        case Payment: return "Payment";
+        case OrderStatus: return "Order-Status";
+        default: return "Unknown";
+    }
+}
+
+struct ClientStats {
+    uint64_t commits[TxnTypeCount] = {};
+    uint64_t aborts[TxnTypeCount] = {};
+    uint64_t invalid_items = 0;   // New-Order aborts required by the workload
+    std::vector<uint64_t> latencies[TxnTypeCount]; // Committed, in microseconds
+};
+
+db::Condition equals(const std::string& column, db::DBValue value) {
+    return db::Condition{column, "=", std::move(value)};
+}
+
+int64_t get_int(const db::Row& row, size_t column) {
+    return std::get<db::DBInt>(row[column]);
+}
+
+double get_float(const db::Row& row, size_t column) {
+    return std::get<db::DBFloat>(row[column]);
+}
+
+// Runs the transaction profiles for one client
+class Client {
+public:
+    Client(db::Database& database, const Options& options, uint64_t seed, int64_t home_warehouse)
+        : database_(database), options_(options), random_(seed), home_w_(home_warehouse),
+          c_customer_(random_.uniform(0, 1023)), c_item_(random_.uniform(0, 8191)),
+          warehouse_(database.get_table("warehouse")), district_(database.get_table("district")),
+          customer_(database.get_table("customer")), item_(database.get_table("item")),
+          stock_(database.get_table("stock")), orders_(database.get_table("orders")),
+          new_order_(database.get_table("new_order")),
+          order_line_(database.get_table("order_line")) {}
+
+    TxnType next_type() {
+        int64_t r = random_.uniform(1, 100);
+        if (r <= 45) return NewOrder;
+        if (r <= 88) return Payment;
+        return OrderStatus;
+    }
+
+    // Returns true if the transaction committed
+    bool run(TxnType type, ClientStats& stats) {
+        uint64_t txn = database_.begin_transaction();
+        bool committed = false;
+
+        switch (type) {
+            case NewOrder: committed = new_order(stats); break;
+            case Payment: committed = payment(); break;
+            case OrderStatus: committed = order_status(); break;
+            default: break;
+        }
+
+        if (committed) {
+            database_.commit_transaction(txn);
+        } else {
+            database_.abort_transaction(txn);
+        }
+        return committed;
+    }
+
+private:
+    db::Database& database_;
+    const Options& options_;
+    Random random_;
+    int64_t home_w_;
+    int64_t c_customer_;
+    int64_t c_item_;
+
+    std::shared_ptr<db::Table> warehouse_;
+    std::shared_ptr<db::Table> district_;
+    std::shared_ptr<db::Table> customer_;
+    std::shared_ptr<db::Table> item_;
+    std::shared_ptr<db::Table> stock_;
+    std::shared_ptr<db::Table> orders_;
+    std::shared_ptr<db::Table> new_order_;
+    std::shared_ptr<db::Table> order_line_;
+
+    int64_t random_customer() {
+        return random_.nurand(1023, c_customer_, 0, options_.customers - 1);
+    }
+
+    int64_t random_item() {
+        return random_.nurand(8191, c_item_, 0, options_.items - 1);
+    }
+
+    // Retry a read-modify-write of one row until no other client changed the
+    // guarded column in between
+    template<typename Modify>
+    void update_row(db::Table& table, const std::string& key_column, int64_t key,
+                    const std::string& guard_column, size_t guard_index, Modify modify) {
+        while (true) {
+            auto rows = table.select({equals(key_column, key)});
+            if (rows.empty()) return;
+
+            const db::Row& row = rows[0];
+            std::unordered_map<std::string, db::DBValue> updates;
+            modify(row, updates);
+            if (table.update(updates, {equals(key_column, key),
+                                       equals(guard_column, row[guard_index])}) > 0) {
+                return;
+            }
+        }
+    }
+
+    bool new_order(ClientStats& stats) {
+        int64_t w = home_w_;
+        int64_t d = random_.uniform(0, kDistrictsPerWarehouse - 1);
+        int64_t c = random_customer();
+        int64_t d_key = district_key(w, d);
+        int64_t ol_cnt = random_.uniform(kMinOrderLines, kMaxOrderLines);
+        bool rollback = random_.uniform(1, 100) == 1;
+
+        struct Line {
+            int64_t item;
+            int64_t supply_w;
+            int64_t quantity;
+            double price;
+        };
+        std::vector<Line> lines;
+        bool all_local = true;
+
+        for (int64_t n = 0; n < ol_cnt; ++n) {
+            Line line;
+            // The last item of a rolled-back order does not exist
+            line.item = rollback && n == ol_cnt - 1 ? options_.items : random_item();
+            line.supply_w = w;
+            if (options_.warehouses > 1 && random_.uniform(1, 100) == 1) {
+                do {
+                    line.supply_w = random_.uniform(0, options_.warehouses - 1);
+                } while (line.supply_w == w);
+                all_local = false;
+            }
+            line.quantity = random_.uniform(1, 10);
+            lines.push_back(line);
+        }
+
+        // Read the items first so an invalid one aborts before any write
+        for (auto& line : lines) {
+            auto rows = item_->select({equals("i_id", line.item)});
+            if (rows.empty()) {
+                stats.invalid_items++;
+                return false;
+            }
+            line.price = get_float(rows[0], I_PRICE);
+        }
+
+        auto warehouses = warehouse_->select({equals("w_id", w)});
+        auto customers = customer_->select({equals("c_key", customer_key(d_key, c))});
+        auto districts = district_->select({equals("d_key", d_key)});
+        if (warehouses.empty() || customers.empty() || districts.empty()) {
+            return false;
+        }
+
+        // Claim the order id; fails if another client took it first
+        int64_t o_id = get_int(districts[0], D_NEXT_O_ID);
+        if (district_->update({{"d_next_o_id", o_id + 1}},
+                              {equals("d_key", d_key), equals("d_next_o_id", o_id)}) == 0) {
+            return false;
+        }
+
+        int64_t o_key = order_key(d_key, o_id);
+        int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        orders_->insert_row({o_key, d_key, o_id, customer_key(d_key, c), now, ol_cnt,
+                             int64_t{all_local ? 1 : 0}});
+        new_order_->insert_row({o_key, d_key});
+
+        double w_tax = get_float(warehouses[0], W_TAX);
+        double d_tax = get_float(districts[0], D_TAX);
+        double discount = get_float(customers[0], C_DISCOUNT);
+        double total = 0.0;
+
+        for (int64_t n = 0; n < ol_cnt; ++n) {
+            const Line& line = lines[static_cast<size_t>(n)];
+
+            update_row(*stock_, "s_key", stock_key(line.supply_w, line.item),
+                       "s_order_cnt", S_ORDER_CNT,
+                       [&](const db::Row& row, std::unordered_map<std::string, db::DBValue>& updates) {
+                           int64_t quantity = get_int(row, S_QUANTITY);
+                           quantity = quantity >= line.quantity + 10
+                               ? quantity - line.quantity
+                               : quantity - line.quantity + 91;
+                           updates["s_quantity"] = quantity;
+                           updates["s_ytd"] = get_int(row, S_YTD) + line.quantity;
+                           updates["s_order_cnt"] = get_int(row, S_ORDER_CNT) + 1;
+                       });
+
+            double amount = static_cast<double>(line.quantity) * line.price;
+            total += amount;
+            order_line_->insert_row({order_line_key(o_key, n), o_key, n, line.item,
+                                     line.supply_w, line.quantity, amount});
+        }
+
+        total *= (1.0 - discount) * (1.0 + w_tax + d_tax);
+        (void)total;
+        return true;
+    }
+
+    bool payment() {
+        int64_t w = home_w_;
+        int64_t d = random_.uniform(0, kDistrictsPerWarehouse - 1);
+        double amount = random_.uniform_real(1.0, 5000.0);
+
+        // 85% of payments are made at the home warehouse
+        int64_t c_w = w;
+        int64_t c_d = d;
+        if (options_.warehouses > 1 && random_.uniform(1, 100) > 85) {
+            do {
+                c_w = random_.uniform(0, options_.warehouses - 1);
+            } while (c_w == w);
+            c_d = random_.uniform(0, kDistrictsPerWarehouse - 1);
+        }
+
+        // 60% select the customer by last name
+        db::Row customer;
+        if (!find_customer(c_w, c_d, random_.uniform(1, 100) <= 60, customer)) {
+            return false;
+        }
+
+        // The warehouse year-to-date total is the hot spot; a concurrent
+        // payment makes this transaction abort
+        auto warehouses = warehouse_->select({equals("w_id", w)});
+        if (warehouses.empty()) {
+            return false;
+        }
+        double w_ytd = get_float(warehouses[0], W_YTD);
+        if (warehouse_->update({{"w_ytd", w_ytd + amount}},
+                               {equals("w_id", w), equals("w_ytd", w_ytd)}) == 0) {
+            return false;
+        }
+
+        update_row(*district_, "d_key", district_key(w, d), "d_ytd", D_YTD,
+                   [&](const db::Row& row, std::unordered_map<std::string, db::DBValue>& updates) {
+                       updates["d_ytd"] = get_float(row, D_YTD) + amount;
+                   });
+
+        update_row(*customer_, "c_key", get_int(customer, C_KEY), "c_payment_cnt", C_PAYMENT_CNT,
+                   [&](const db::Row& row, std::unordered_map<std::string, db::DBValue>& updates) {
+                       updates["c_balance"] = get_float(row, C_BALANCE) - amount;
+                       updates["c_ytd_payment"] = get_float(row, C_YTD_PAYMENT) + amount;
+                       updates["c_payment_cnt"] = get_int(row, C_PAYMENT_CNT) + 1;
+                   });
+        return true;
+    }
+
+    bool order_status() {
+        int64_t w = home_w_;
+        int64_t d = random_.uniform(0, kDistrictsPerWarehouse - 1);
+
+        db::Row customer;
+        if (!find_customer(w, d, random_.uniform(1, 100) <= 60, customer)) {
+            return false;
+        }
+
+        // Most recent order of the customer and its lines
+        auto orders = orders_->select({equals("o_c_key", get_int(customer, C_KEY))});
+        if (orders.empty()) {
+            return true;
+        }
+        auto latest = std::max_element(orders.begin(), orders.end(),
+                                       [](const db::Row& a, const db::Row& b) {
+                                           return get_int(a, O_ID) < get_int(b, O_ID);
+                                       });
+        auto lines = order_line_->select({equals("ol_o_key", get_int(*latest, O_KEY))});
+        return lines.size() == static_cast<size_t>(get_int(*latest, O_OL_CNT));
+    }
+
+    // By id, or by last name choosing the middle match sorted by first name
+    bool find_customer(int64_t w, int64_t d, bool by_last_name, db::Row& out) {
+        int64_t d_key = district_key(w, d);
+        int64_t c = random_customer();
+
+        if (!by_last_name) {
+            auto rows = customer_->select({equals("c_key", customer_key(d_key, c))});
+            if (rows.empty()) return false;
+            out = std::move(rows[0]);
+            return true;
+        }
+
+        int64_t name = c < 1000 ? c : random_.nurand(255, 0, 0, 999);
+        auto rows = customer_->select({equals("c_w_id", w), equals("c_d_id", d),
+                                       equals("c_last", last_name(name))});
+        if (rows.empty()) return false;
+
+        std::sort(rows.begin(), rows.end(), [](const db::Row& a, const db::Row& b) {
+            return std::get<db::DBText>(a[C_FIRST]) < std::get<db::DBText>(b[C_FIRST]);
+        });
+        out = std::move(rows[(rows.size() - 1) / 2]);
+        return true;
+    }
+};
+
+double percentile_ms(std::vector<uint64_t>& samples, double p) {
+    if (samples.empty()) return 0.0;
+    size_t index = std::min(samples.size() - 1,
+                            static_cast<size_t>(p * static_cast<double>(samples.size())));
+    std::nth_element(samples.begin(), samples.begin() + static_cast<long>(index), samples.end());
+    return static_cast<double>(samples[index]) / 1000.0;
+}
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for option: " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        try {
+            if (arg == "--warehouses") {
+                options.warehouses = std::stoll(value);
+            } else if (arg == "--clients") {
+                options.clients = std::stoull(value);
+            } else if (arg == "--duration") {
+                options.duration = std::stod(value);
+            } else if (arg == "--items") {
+                options.items = std::stoll(value);
+            } else if (arg == "--customers") {
+                options.customers = std::stoll(value);
+            } else if (arg == "--seed") {
+                options.seed = std::stoull(value);
+            } else {
+                std::cerr << "Unknown option: " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << ": " << value << std::endl;
+            return false;
+        }
+    }
+
+    if (options.warehouses <= 0 || options.clients == 0 || options.items <= 0 ||
+        options.customers <= 0 || options.items > 1000000 || options.customers > 100000) {
+        std::cerr << "Invalid scale: need 1+ warehouses and clients, 1-1000000 items "
+                  << "and 1-100000 customers per district" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        return 1;
+    }
+
+    db::Database database("tpcc");
+    create_schema(database);
+
+    auto load_start = Clock::now();
+    load(database, options);
+    double load_seconds = std::chrono::duration<double>(Clock::now() - load_start).count();
+
+    std::cout << "TPC-C-lite: " << options.warehouses << " warehouses, "
+              << options.items << " items, " << options.customers
+              << " customers per district, " << options.clients << " clients\n"
+              << std::fixed << std::setprecision(2)
+              << "  Load: " << load_seconds << " s\n";
+
+    std::vector<ClientStats> stats(options.clients);
+    std::vector<std::thread> clients;
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+
+    for (size_t t = 0; t < options.clients; ++t) {
+        clients.emplace_back([&, t]() {
+            // Clients are spread over the warehouses like TPC-C terminals
+            Client client(database, options, options.seed + 1 + t,
+                          static_cast<int64_t>(t) % options.warehouses);
+            ClientStats& s = stats[t];
+
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                TxnType type = client.next_type();
+                auto begin = Clock::now();
+                if (client.run(type, s)) {
+                    s.commits[type]++;
+                    s.latencies[type].push_back(static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                            Clock::now() - begin).count()));
+                } else {
+                    s.aborts[type]++;
+                }
+            }
+        });
+    }
+
+    auto run_start = Clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.duration));
+    stop.store(true);
+    for (auto& client : clients) {
+        client.join();
+    }
+    double run_seconds = std::chrono::duration<double>(Clock::now() - run_start).count();
+
+    // Report
+    uint64_t total_commits = 0;
+    uint64_t total_aborts = 0;
+    uint64_t invalid_items = 0;
+    for (const auto& s : stats) {
+        invalid_items += s.invalid_items;
+    }
+
+    std::cout << "  Run:  " << run_seconds << " s\n\n"
+              << std::left << std::setw(14) << "transaction" << std::right
+              << std::setw(10) << "commits" << std::setw(10) << "aborts"
+              << std::setw(10) << "abort%" << std::setw(12) << "p50 ms"
+              << std::setw(12) << "p99 ms" << "\n";
+
+    for (int type = 0; type < TxnTypeCount; ++type) {
+        uint64_t commits = 0;
+        uint64_t aborts = 0;
+        std::vector<uint64_t> latencies;
+        for (const auto& s : stats) {
+            commits += s.commits[type];
+            aborts += s.aborts[type];
+            latencies.insert(latencies.end(), s.latencies[type].begin(), s.latencies[type].end());
+        }
+        total_commits += commits;
+        total_aborts += aborts;
+
+        uint64_t attempts = commits + aborts;
+        std::cout << std::left << std::setw(14) << txn_name(type) << std::right
+                  << std::setw(10) << commits << std::setw(10) << aborts
+                  << std::setw(10) << (attempts ? 100.0 * aborts / attempts : 0.0)
+                  << std::setw(12) << percentile_ms(latencies, 0.50)
+                  << std::setw(12) << percentile_ms(latencies, 0.99) << "\n";
+    }
+
+    uint64_t new_orders = 0;
+    for (const auto& s : stats) {
+        new_orders += s.commits[NewOrder];
+    }
+    uint64_t attempts = total_commits + total_aborts;
+
+    std::cout << "\n  tpmC:       " << std::setprecision(0)
+              << static_cast<double>(new_orders) * 60.0 / run_seconds << "\n"
+              << "  Throughput: " << static_cast<double>(total_commits) / run_seconds
+              << " txn/sec\n"
+              << std::setprecision(2)
+              << "  Abort rate: " << (attempts ? 100.0 * total_aborts / attempts : 0.0)
+              << "% (" << invalid_items << " invalid-item rollbacks, "
+              << total_aborts - invalid_items << " conflicts)\n";
+    return 0;
+}
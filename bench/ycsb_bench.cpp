@@ -0,0 +1,479 @@
+// YCSB-style benchmark for db::Table
+//
+// Implements the core YCSB workloads:
+//   A  50% read, 50% update                 (zipfian)
+//   B  95% read,  5% update                 (zipfian)
+//   C  100% read                            (zipfian)
+//   D  95% read,  5% insert                 (latest)
+//   E  95% short range scan, 5% insert      (zipfian start, uniform length)
+//   F  50% read, 50% read-modify-write      (zipfian)
+//
+// Usage: toydb_bench [--workload A-F|all] [--records N] [--operations N]
+//                    [--threads N] [--fields N] [--field-length N]
+//                    [--distribution zipfian|uniform] [--max-scan-length N]
+//                    [--seed N] [--key-filter on|off] [--engine heap|lsm]
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <cctype>
+#include <cstdint>
+#include "../include/db/database.h"
+
+using namespace toydb;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum class Distribution {
+    Uniform,
+    Zipfian,
+    Latest
+};
+
+enum Op {
+    OpRead,
+    OpUpdate,
+    OpInsert,
+    OpScan,
+    OpReadModifyWrite,
+    OpCount
+};
+
+const char* op_name(int op) {
+    switch (op) {
+        case OpRead: return "READ";
+        case OpUpdate: return "UPDATE";
+        case OpInsert: return "INSERT";
+        case OpScan: return "SCAN";
+        case OpReadModifyWrite: return "RMW";
+        default: return "UNKNOWN";
+    }
+}
+
+struct Workload {
+    char name;
+    double proportions[OpCount];
+    Distribution distribution;
+};
+
+const Workload kWorkloads[] = {
+    {'A', {0.50, 0.50, 0.00, 0.00, 0.00}, Distribution::Zipfian},
+    {'B', {0.95, 0.05, 0.00, 0.00, 0.00}, Distribution::Zipfian},
+    {'C', {1.00, 0.00, 0.00, 0.00, 0.00}, Distribution::Zipfian},
+    {'D', {0.95, 0.00, 0.05, 0.00, 0.00}, Distribution::Latest},
+    {'E', {0.00, 0.00, 0.05, 0.95, 0.00}, Distribution::Zipfian},
+    {'F', {0.50, 0.00, 0.00, 0.00, 0.50}, Distribution::Zipfian},
+};
+
+struct Options {
+    std::string workloads = "A";
+    size_t records = 10000;
+    size_t operations = 50000;
+    size_t threads = 1;
+    size_t fields = 10;
+    size_t field_length = 100;
+    bool uniform = false;          // Replace zipfian with uniform key choice
+    size_t max_scan_length = 100;
+    uint64_t seed = 42;
+    bool key_filter = true;        // Primary key Bloom filter
+    db::StorageEngine engine = db::StorageEngine::Heap;
+};
+
+// Zipfian generator over [0, n) from Gray et al., "Quickly Generating
+// Billion-Record Synthetic Databases", as used by YCSB (theta = 0.99)
+class ZipfianGenerator {
+public:
+    explicit ZipfianGenerator(uint64_t n, double theta = 0.99)
+        : n_(n), theta_(theta) {
+        double zeta2 = zeta(2, theta);
+        zetan_ = zeta(n, theta);
+        alpha_ = 1.0 / (1.0 - theta);
+        eta_ = (1.0 - std::pow(2.0 / static_cast<double>(n), 1.0 - theta)) /
+               (1.0 - zeta2 / zetan_);
+    }
+
+    // 0 is the most popular item
+    uint64_t next(std::mt19937_64& rng) const {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        double uz = u * zetan_;
+
+        if (uz < 1.0) return 0;
+        if (uz < 1.0 + std::pow(0.5, theta_)) return 1;
+
+        auto item = static_cast<uint64_t>(static_cast<double>(n_) *
+                                          std::pow(eta_ * u - eta_ + 1.0, alpha_));
+        return std::min(item, n_ - 1);
+    }
+
+private:
+    uint64_t n_;
+    double theta_;
+    double zetan_;
+    double alpha_;
+    double eta_;
+
+    static double zeta(uint64_t n, double theta) {
+        double sum = 0.0;
+        for (uint64_t i = 1; i <= n; ++i) {
+            sum += 1.0 / std::pow(static_cast<double>(i), theta);
+        }
+        return sum;
+    }
+};
+
+// 64-bit FNV-1a, used to scatter popular zipfian items over the key space
+uint64_t fnv_hash(uint64_t value) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < 8; ++i) {
+        hash ^= value & 0xff;
+        hash *= 0x100000001b3ULL;
+        value >>= 8;
+    }
+    return hash;
+}
+
+// Chooses keys for one client thread
+class KeyChooser {
+public:
+    KeyChooser(Distribution distribution, const ZipfianGenerator& zipfian,
+               const std::atomic<uint64_t>& key_count)
+        : distribution_(distribution), zipfian_(zipfian), key_count_(key_count) {}
+
+    uint64_t next(std::mt19937_64& rng) const {
+        uint64_t count = key_count_.load(std::memory_order_acquire);
+
+        switch (distribution_) {
+            case Distribution::Uniform:
+                return std::uniform_int_distribution<uint64_t>(0, count - 1)(rng);
+            case Distribution::Zipfian:
+                return fnv_hash(zipfian_.next(rng)) % count;
+            case Distribution::Latest: {
+                // Most recently inserted keys are the most popular
+                uint64_t offset = zipfian_.next(rng) % count;
+                return count - 1 - offset;
+            }
+        }
+        return 0;
+    }
+
+private:
+    Distribution distribution_;
+    const ZipfianGenerator& zipfian_;
+    const std::atomic<uint64_t>& key_count_;
+};
+
+// Field values are slices of one random buffer, so generating them does not
+// dominate the measured operations
+class ValueSource {
+public:
+    ValueSource(size_t field_length, uint64_t seed) : field_length_(field_length) {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<int> chars(' ', '~');
+        buffer_.resize(std::max<size_t>(field_length * 64, 1 << 16));
+        for (auto& c : buffer_) {
+            c = static_cast<char>(chars(rng));
+        }
+    }
+
+    db::DBValue next(std::mt19937_64& rng) const {
+        size_t offset = std::uniform_int_distribution<size_t>(
+            0, buffer_.size() - field_length_)(rng);
+        return db::DBText(buffer_.data() + offset, field_length_);
+    }
+
+private:
+    size_t field_length_;
+    std::string buffer_;
+};
+
+const char* kTableName = "usertable";
+const char* kKeyColumn = "ycsb_key";
+
+std::string field_name(size_t i) {
+    return "field" + std::to_string(i);
+}
+
+db::Row make_row(uint64_t key, const Options& options, const ValueSource& values,
+                 std::mt19937_64& rng) {
+    db::Row row;
+    row.reserve(options.fields + 1);
+    row.emplace_back(static_cast<db::DBInt>(key));
+    for (size_t i = 0; i < options.fields; ++i) {
+        row.push_back(values.next(rng));
+    }
+    return row;
+}
+
+db::Conditions key_equals(uint64_t key) {
+    return {db::Condition{kKeyColumn, "=", static_cast<db::DBInt>(key)}};
+}
+
+// Per-thread latency samples in nanoseconds, one vector per operation type
+struct ThreadResult {
+    std::vector<uint64_t> latencies[OpCount];
+};
+
+double percentile_us(const std::vector<uint64_t>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+    size_t index = std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0);
+    return static_cast<double>(sorted[index]) / 1000.0;
+}
+
+Op choose_op(const Workload& workload, std::mt19937_64& rng) {
+    double r = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    for (int op = 0; op < OpCount; ++op) {
+        r -= workload.proportions[op];
+        if (r < 0.0) return static_cast<Op>(op);
+    }
+    return OpRead;
+}
+
+void run_workload(const Workload& workload, const Options& options) {
+    db::Database database("ycsb");
+
+    std::vector<db::ColumnDef> columns;
+    columns.push_back({kKeyColumn, db::ColumnType::Int, true, true});
+    for (size_t i = 0; i < options.fields; ++i) {
+        columns.push_back({field_name(i), db::ColumnType::Text, false, false});
+    }
+    database.create_table(kTableName, columns, options.engine);
+    auto table = database.get_table(kTableName);
+    table->set_key_filter(options.key_filter);
+
+    ValueSource values(options.field_length, options.seed);
+
+    // Load phase
+    std::mt19937_64 load_rng(options.seed);
+    auto load_start = Clock::now();
+    for (uint64_t key = 0; key < options.records; ++key) {
+        table->insert_row(make_row(key, options, values, load_rng));
+    }
+    double load_seconds = std::chrono::duration<double>(Clock::now() - load_start).count();
+
+    // Run phase
+    Distribution distribution = workload.distribution;
+    if (options.uniform && distribution == Distribution::Zipfian) {
+        distribution = Distribution::Uniform;
+    }
+
+    ZipfianGenerator zipfian(options.records);
+    std::atomic<uint64_t> key_count{options.records};
+    std::atomic<uint64_t> next_insert_key{options.records};
+    std::atomic<bool> start{false};
+
+    std::vector<ThreadResult> results(options.threads);
+    std::vector<std::thread> clients;
+
+    for (size_t t = 0; t < options.threads; ++t) {
+        size_t ops = options.operations / options.threads +
+                     (t < options.operations % options.threads ? 1 : 0);
+
+        clients.emplace_back([&, t, ops]() {
+            std::mt19937_64 rng(options.seed + 1 + t);
+            KeyChooser keys(distribution, zipfian, key_count);
+            ThreadResult& result = results[t];
+            for (auto& samples : result.latencies) {
+                samples.reserve(ops);
+            }
+
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            for (size_t i = 0; i < ops; ++i) {
+                Op op = choose_op(workload, rng);
+                auto begin = Clock::now();
+
+                switch (op) {
+                    case OpRead:
+                        table->select(key_equals(keys.next(rng)));
+                        break;
+                    case OpUpdate: {
+                        size_t field = std::uniform_int_distribution<size_t>(
+                            0, options.fields - 1)(rng);
+                        table->update({{field_name(field), values.next(rng)}},
+                                      key_equals(keys.next(rng)));
+                        break;
+                    }
+                    case OpInsert: {
+                        uint64_t key = next_insert_key.fetch_add(1);
+                        table->insert_row(make_row(key, options, values, rng));
+                        // Keys become visible to readers in order only once
+                        // every earlier insert has finished
+                        uint64_t expected = key;
+                        while (!key_count.compare_exchange_weak(expected, key + 1)) {
+                            expected = key;
+                            std::this_thread::yield();
+                        }
+                        break;
+                    }
+                    case OpScan: {
+                        uint64_t first = keys.next(rng);
+                        uint64_t length = std::uniform_int_distribution<uint64_t>(
+                            1, options.max_scan_length)(rng);
+                        table->select({
+                            db::Condition{kKeyColumn, ">=", static_cast<db::DBInt>(first)},
+                            db::Condition{kKeyColumn, "<", static_cast<db::DBInt>(first + length)}
+                        });
+                        break;
+                    }
+                    case OpReadModifyWrite: {
+                        uint64_t key = keys.next(rng);
+                        size_t field = std::uniform_int_distribution<size_t>(
+                            0, options.fields - 1)(rng);
+                        table->select(key_equals(key));
+                        table->update({{field_name(field), values.next(rng)}}, key_equals(key));
+                        break;
+                    }
+                    default:
+                        break;
+                }
+
+                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    Clock::now() - begin);
+                result.latencies[op].push_back(static_cast<uint64_t>(elapsed.count()));
+            }
+        });
+    }
+
+    auto run_start = Clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& client : clients) {
+        client.join();
+    }
+    double run_seconds = std::chrono::duration<double>(Clock::now() - run_start).count();
+
+    // Report
+    static const char* kDistributionNames[] = {"uniform", "zipfian", "latest"};
+    std::cout << "Workload " << workload.name << " ("
+              << kDistributionNames[static_cast<int>(distribution)] << "): "
+              << options.records << " records, " << options.operations << " operations, "
+              << options.threads << " threads, " << options.fields << " x "
+              << options.field_length << " byte fields, "
+              << db::engine_to_string(options.engine) << " engine\n";
+    std::cout << std::fixed << std::setprecision(3)
+              << "  Load:       " << load_seconds << " s ("
+              << std::setprecision(0) << options.records / load_seconds << " inserts/sec)\n"
+              << std::setprecision(3)
+              << "  Runtime:    " << run_seconds << " s\n"
+              << std::setprecision(0)
+              << "  Throughput: " << options.operations / run_seconds << " ops/sec\n";
+
+    for (int op = 0; op < OpCount; ++op) {
+        std::vector<uint64_t> samples;
+        for (auto& result : results) {
+            samples.insert(samples.end(), result.latencies[op].begin(),
+                           result.latencies[op].end());
+        }
+        if (samples.empty()) continue;
+
+        std::sort(samples.begin(), samples.end());
+        double sum = 0.0;
+        for (uint64_t sample : samples) {
+            sum += static_cast<double>(sample);
+        }
+
+        std::cout << std::setprecision(2)
+                  << "  " << std::left << std::setw(7) << op_name(op) << std::right
+                  << " count=" << samples.size()
+                  << " avg=" << sum / static_cast<double>(samples.size()) / 1000.0 << "us"
+                  << " p50=" << percentile_us(samples, 0.50) << "us"
+                  << " p99=" << percentile_us(samples, 0.99) << "us"
+                  << " p999=" << percentile_us(samples, 0.999) << "us\n";
+    }
+    std::cout << std::endl;
+}
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for option: " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        try {
+            if (arg == "--workload") {
+                options.workloads = value == "all" ? "ABCDEF" : value;
+            } else if (arg == "--records") {
+                options.records = std::stoull(value);
+            } else if (arg == "--operations") {
+                options.operations = std::stoull(value);
+            } else if (arg == "--threads") {
+                options.threads = std::stoull(value);
+            } else if (arg == "--fields") {
+                options.fields = std::stoull(value);
+            } else if (arg == "--field-length") {
+                options.field_length = std::stoull(value);
+            } else if (arg == "--distribution") {
+                if (value != "zipfian" && value != "uniform") {
+                    std::cerr << "Unknown distribution: " << value << std::endl;
+                    return false;
+                }
+                options.uniform = value == "uniform";
+            } else if (arg == "--max-scan-length") {
+                options.max_scan_length = std::stoull(value);
+            } else if (arg == "--seed") {
+                options.seed = std::stoull(value);
+            } else if (arg == "--key-filter") {
+                if (value != "on" && value != "off") {
+                    std::cerr << "--key-filter must be on or off" << std::endl;
+                    return false;
+                }
+                options.key_filter = value == "on";
+            } else if (arg == "--engine") {
+                if (value != "heap" && value != "lsm") {
+                    std::cerr << "--engine must be heap or lsm" << std::endl;
+                    return false;
+                }
+                options.engine = value == "lsm" ? db::StorageEngine::Lsm : db::StorageEngine::Heap;
+            } else {
+                std::cerr << "Unknown option: " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << ": " << value << std::endl;
+            return false;
+        }
+    }
+
+    if (options.records == 0 || options.threads == 0 || options.fields == 0 ||
+        options.field_length == 0 || options.max_scan_length == 0) {
+        std::cerr << "--records, --threads, --fields, --field-length and "
+                  << "--max-scan-length must be positive" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        return 1;
+    }
+
+    for (char name : options.workloads) {
+        auto it = std::find_if(std::begin(kWorkloads), std::end(kWorkloads),
+                               [name](const Workload& w) { return w.name == std::toupper(name); });
+        if (it == std::end(kWorkloads)) {
+            std::cerr << "Unknown workload: " << name << std::endl;
+            return 1;
+        }
+        run_workload(*it, options);
+    }
+
+    return 0;
+}
@@ -5,6 +5,7 @@
 #include <vector>
 #include "../db/database.h"
 #include "../parser/parser.h"
+#include "../metrics/slow_query_log.h"
 
 namespace toydb {
 namespace cli {
@@ -27,14 +28,32 @@ private:
     std::shared_ptr<db::Database> db_;
     parser::Parser parser_;
     
+    // Temporaries of the statement being executed
+    db::QueryArena arena_;
+    
+    // Profile of the current statement; only filled in while the slow query
+    // log is enabled
+    metrics::QueryProfile profile_;
+    bool profiling_ = false;
+    
+    std::chrono::nanoseconds* phase(std::chrono::nanoseconds metrics::QueryProfile::*member) {
+        return profiling_ ? &(profile_.*member) : nullptr;
+    }
+    
+    // Copy the access path and row counts of a table call into the profile
+    void record_scan(const db::ScanStats& stats, size_t rows_returned);
+    
     // Handle specific statement types
     void handle_create_table(const parser::CreateTableStmt& stmt);
+    void handle_create_index(const parser::CreateIndexStmt& stmt);
     void handle_insert(const parser::InsertStmt& stmt);
     void handle_select(const parser::SelectStmt& stmt);
     void handle_update(const parser::UpdateStmt& stmt);
     void handle_delete(const parser::DeleteStmt& stmt);
     void handle_drop_table(const parser::DropTableStmt& stmt);
     void handle_show_tables(const parser::ShowTablesStmt& stmt);
+    void handle_show_metrics(const parser::ShowMetricsStmt& stmt);
+    void handle_show_table_status(const parser::ShowTableStatusStmt& stmt);
     void handle_begin_transaction(const parser::BeginTransactionStmt& stmt);
     void handle_commit_transaction(const parser::CommitTransactionStmt& stmt);
     void handle_abort_transaction(const parser::AbortTransactionStmt& stmt);
@@ -42,6 +61,9 @@ private:
     // Print help/usage information
     void print_help() const;
     
+    // Export trace spans (TOYDB_TRACING builds only)
+    void write_trace(const std::string& path) const;
+    
     // Parse a row of values for INSERT
     db::Row parse_row(const std::vector<std::string>& value_strs, 
                       const std::vector<db::ColumnDef>& columns, 
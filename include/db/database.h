@@ -5,6 +5,8 @@
 #include <unordered_map>
 #include <optional>
 #include "table.h"
+#include "index.h"
+#include "transaction.h"
 
 namespace toydb {
 namespace db {
@@ -16,11 +18,15 @@ public:
     const std::string& name() const { return name_; }
     
     // Create a new table
-    bool create_table(const std::string& name, const std::vector<ColumnDef>& columns);
+    bool create_table(const std::string& name, const std::vector<ColumnDef>& columns,
+                      StorageEngine engine = StorageEngine::Heap);
     
     // Drop a table
     bool drop_table(const std::string& name);
     
+    // Create a secondary index on a table
+    bool create_index(const std::string& table_name, const IndexDef& def);
+    
     // Get a table by name
     std::shared_ptr<Table> get_table(const std::string& name) const;
     
@@ -29,6 +35,16 @@ public:
     
     // Check if a table exists
     bool table_exists(const std::string& name) const;
+    
+    // SHOW TABLE STATUS result: one row per table, sorted by name, with its
+    // engine, row count, memory and disk use and primary key index shape
+    static const std::vector<ColumnDef>& table_status_columns();
+    std::vector<Row> table_status_rows() const;
+    
+    // Transaction management
+    uint64_t begin_transaction();
+    void commit_transaction(uint64_t id);
+    void abort_transaction(uint64_t id);
 
 private:
     std::string name_;
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <map>
+#include <cstdint>
+#include <limits>
+#include "table.h"
+#include "../storage/bplustree.h"
+#include "../storage/art.h"
+#include "../storage/hash_table.h"
+#include "../storage/roaring_bitmap.h"
+
+namespace toydb {
+namespace db {
+
+// Secondary index implementations
+enum class IndexType {
+    BTree,  // Ordered; serves equality and range predicates
+    Hash,   // Equality only, O(1) probes
+    Art,    // Ordered like BTree, on an adaptive radix tree
+    Bitmap  // Bitmap per distinct value, for low-cardinality columns
+};
+
+std::string index_type_to_string(IndexType type);
+
+// Definition of a secondary index as given to CREATE INDEX
+struct IndexDef {
+    std::string name;
+    std::vector<std::string> columns;
+    IndexType type = IndexType::BTree;
+    std::vector<std::string> include;   // INCLUDE columns stored with each entry (BTREE only)
+    std::vector<Condition> where;       // AND-ed predicate of a partial index; empty for all rows
+};
+
+// A non-unique secondary index mapping column values to row positions in
+// the owning table. The table holds its lock while calling any method.
+class Index {
+public:
+    Index(IndexDef def, std::vector<size_t> column_positions,
+          std::vector<size_t> include_positions = {})
+        : def_(std::move(def)), column_positions_(std::move(column_positions)),
+          include_positions_(std::move(include_positions)) {}
+    virtual ~Index() = default;
+
+    const IndexDef& def() const { return def_; }
+    const std::vector<size_t>& column_positions() const { return column_positions_; }
+
+    // True if the index stores a column, as a key or INCLUDE column, by
+    // position in the row
+    bool covers_column(size_t column) const;
+    
+    // Partial indexes hold only the rows satisfying their WHERE predicate;
+    // the table inserts and erases just those
+    bool indexes_row(const Row& row, const std::vector<ColumnDef>& columns) const;
+    // True if the predicate refers to the column, so updating it can move
+    // rows into or out of the index
+    bool filters_on(const std::string& column) const;
+    // True if every row matching the conditions satisfies the predicate, so
+    // the index holds all candidates for a query with these conditions
+    bool usable_for(const Conditions& conditions) const;
+
+    virtual void insert(const Row& row, size_t position) = 0;
+    virtual void erase(const Row& row, size_t position) = 0;
+    virtual void clear() = 0;
+
+    // Positions of rows matching one condition on the first indexed column,
+    // or nullopt if the index cannot serve the condition. Callers still
+    // evaluate every condition on the rows they fetch.
+    virtual std::optional<RowPositions> lookup(const Condition& condition) const = 0;
+    
+    // IN lookup as one equality probe per distinct value, probed in sorted
+    // order so consecutive descents reuse cached nodes; positions come back
+    // in table order
+    std::optional<RowPositions> lookup_in(const Condition& condition) const;
+
+    // Approximate bytes held by the index structure
+    virtual size_t memory_bytes() const = 0;
+
+protected:
+    IndexDef def_;
+    std::vector<size_t> column_positions_;
+    std::vector<size_t> include_positions_;
+
+    const DBValue& key_of(const Row& row) const { return row[column_positions_[0]]; }
+};
+
+// Hash of a DBValue that treats each alternative separately
+struct DBValueHash {
+    size_t operator()(const DBValue& value) const { return std::hash<DBValue>()(value); }
+};
+
+// Equality-only index on a Swiss-table style hash multimap
+class HashIndex : public Index {
+public:
+    using Index::Index;
+
+    void insert(const Row& row, size_t position) override;
+    void erase(const Row& row, size_t position) override;
+    void clear() override;
+    std::optional<RowPositions> lookup(const Condition& condition) const override;
+    size_t memory_bytes() const override;
+
+private:
+    storage::HashTable<DBValue, size_t, DBValueHash> table_;
+};
+
+// Ordered index on a B+ tree. Keys are (value, position) pairs so equal
+// values stay distinct; equality and ranges are answered by range scans.
+class BTreeIndex : public Index {
+public:
+    using Index::Index;
+
+    void insert(const Row& row, size_t position) override;
+    void erase(const Row& row, size_t position) override;
+    void clear() override;
+    std::optional<RowPositions> lookup(const Condition& condition) const override;
+    size_t memory_bytes() const override;
+
+private:
+    using Key = std::pair<DBValue, size_t>;
+    storage::BPlusTree<Key, size_t, 64> tree_;
+};
+
+// Ordered index on an adaptive radix tree, keyed like BTreeIndex. Point
+// lookups walk one node per key byte rather than binary-searching nodes.
+class ArtIndex : public Index {
+public:
+    using Index::Index;
+
+    void insert(const Row& row, size_t position) override;
+    void erase(const Row& row, size_t position) override;
+    void clear() override;
+    std::optional<RowPositions> lookup(const Condition& condition) const override;
+    size_t memory_bytes() const override;
+
+private:
+    using Key = std::pair<DBValue, size_t>;
+    storage::AdaptiveRadixTree<Key, size_t> tree_;
+};
+
+// One compressed bitmap of row positions per distinct value. Any operator is
+// answered by OR-ing the bitmaps of the values that satisfy it, so the index
+// suits columns with few distinct values (flags, enums, status codes); the
+// table ANDs the bitmaps of all conditions it covers before reading a row.
+// Positions must fit in 32 bits; the table refuses rows past kMaxPosition
+// while it has a bitmap index.
+class BitmapIndex : public Index {
+public:
+    using Index::Index;
+
+    static constexpr size_t kMaxPosition = std::numeric_limits<uint32_t>::max();
+
+    void insert(const Row& row, size_t position) override;
+    void erase(const Row& row, size_t position) override;
+    void clear() override;
+    std::optional<RowPositions> lookup(const Condition& condition) const override;
+    size_t memory_bytes() const override;
+
+    // Rows matching one condition on the indexed column
+    storage::RoaringBitmap lookup_bitmap(const Condition& condition) const;
+
+private:
+    std::map<DBValue, storage::RoaringBitmap> bitmaps_;
+};
+
+// The conditions a composite index can serve: equalities on a leftmost
+// prefix of its columns, then at most one lower and one upper bound on the
+// column after them
+struct PrefixMatch {
+    std::vector<const Condition*> equalities;
+    const Condition* lower = nullptr;   // > or >=
+    const Condition* upper = nullptr;   // < or <=
+
+    bool empty() const { return equalities.empty() && !lower && !upper; }
+};
+
+// Ordered index on several columns, or on any columns plus INCLUDE columns.
+// Each key is the memcmp-comparable encodings of the column values (see
+// KeyCodec<DBValue>) followed by the row position, so one B+ tree over byte
+// strings orders rows by the column tuple and a prefix match is a single
+// bounded scan. INCLUDE column values ride along in the leaf entries, and
+// key values decode back out of the key, so a query touching only stored
+// columns never reads the table's rows.
+class CompositeIndex : public Index {
+public:
+    using Index::Index;
+
+    void insert(const Row& row, size_t position) override;
+    void erase(const Row& row, size_t position) override;
+    void clear() override;
+    std::optional<RowPositions> lookup(const Condition& condition) const override;
+    size_t memory_bytes() const override;
+
+    // The conditions this index can serve, empty if none
+    PrefixMatch match(const Conditions& conditions) const;
+
+    // Positions of rows satisfying every condition in the match
+    RowPositions lookup(const PrefixMatch& match) const;
+
+    // Index-only scan: call func with a row of the given width holding the
+    // stored columns (others NULL) and the row position for each entry in
+    // the match; returns the number of entries visited
+    size_t scan_stored(const PrefixMatch& match, size_t width,
+                       const std::function<void(const Row&, size_t)>& func) const;
+
+private:
+    struct Entry {
+        size_t position = 0;
+        Row included;       // Values of the INCLUDE columns, in order
+    };
+
+    storage::BPlusTree<std::string, Entry, 64> tree_;
+
+    std::string encode(const Row& row, size_t position) const;
+    void scan(const PrefixMatch& match,
+              const std::function<void(const std::string&, const Entry&)>& func) const;
+};
+
+// Build an empty index of the given type; BTREE definitions with several
+// columns or INCLUDE columns get a CompositeIndex
+std::unique_ptr<Index> make_index(IndexDef def, std::vector<size_t> column_positions,
+                                  std::vector<size_t> include_positions = {});
+
+} // namespace db
+
+namespace storage {
+
+// Byte encoding of a DBValue whose memcmp order matches DBValue's ordering:
+// a type tag followed by an order-preserving encoding of the value
+template<>
+struct KeyCodec<db::DBValue> {
+    static void encode(const db::DBValue& value, std::string& out);
+    // Decode the value starting at offset and advance offset past it
+    static db::DBValue decode(const std::string& in, size_t& offset);
+};
+
+} // namespace storage
+} // namespace toydb
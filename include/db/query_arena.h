@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+namespace toydb {
+namespace db {
+
+// Monotonic allocator for the temporaries of one statement (tokens,
+// converted conditions). Allocating is a pointer bump and deallocating is a
+// no-op; release() drops everything at once and reuses the inline block, so
+// a typical statement never reaches malloc.
+class QueryArena {
+public:
+    static constexpr size_t kInlineBytes = 16 * 1024;
+
+    QueryArena() : resource_(buffer_.data(), buffer_.size()) {}
+
+    QueryArena(const QueryArena&) = delete;
+    QueryArena& operator=(const QueryArena&) = delete;
+
+    std::pmr::memory_resource* resource() { return &resource_; }
+
+    // Free everything allocated since the last release
+    void release() { resource_.release(); }
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, kInlineBytes> buffer_;
+    std::pmr::monotonic_buffer_resource resource_;
+};
+
+// Releases an arena when the statement that uses it goes out of scope
+class ArenaScope {
+public:
+    explicit ArenaScope(QueryArena& arena) : arena_(arena) {}
+    ~ArenaScope() { arena_.release(); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    QueryArena& arena_;
+};
+
+} // namespace db
+} // namespace toydb
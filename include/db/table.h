@@ -7,9 +7,16 @@
 #include <variant>
 #include <optional>
 #include <functional>
+#include <shared_mutex>
+#include <memory_resource>
 #include "../storage/bplustree.h"
+#include "../storage/bloom_filter.h"
 
 namespace toydb {
+namespace storage {
+class LsmTree;
+}
+
 namespace db {
 
 // Define the types our database can handle
@@ -27,6 +34,14 @@ enum class ColumnType {
     Text
 };
 
+// How a table stores its rows
+enum class StorageEngine {
+    Heap,   // Rows in memory, primary key and secondary indexes on top
+    Lsm     // Rows in an LSM tree keyed by primary key, for write-heavy tables
+};
+
+std::string engine_to_string(StorageEngine engine);
+
 // Column definition
 struct ColumnDef {
     std::string name;
@@ -41,56 +56,189 @@ std::string type_to_string(ColumnType type);
 std::string value_to_string(const DBValue& value);
 bool values_equal(const DBValue& a, const DBValue& b);
 bool values_less(const DBValue& a, const DBValue& b);
+// a op b for a condition operator (=, >, <, >=, <=, !=)
+bool compare_values(const DBValue& a, const std::string& op, const DBValue& b);
 
 // Row is a vector of values
 using Row = std::vector<DBValue>;
 
+struct Condition;
+
+// AND-ed conditions of one statement; callers may back them with a QueryArena
+using Conditions = std::pmr::vector<Condition>;
+
 // Condition for filtering rows
 struct Condition {
     std::string column_name;
-    std::string op; // =, >, <, >=, <=, !=
+    std::string op; // =, >, <, >=, <=, !=, IN, OR
     DBValue value;
+    std::vector<DBValue> values = {};       // IN: the list, matched by equality
+    std::vector<Conditions> any_of = {};    // OR: holds if every condition of one branch does
     
     bool evaluate(const Row& row, const std::vector<ColumnDef>& columns) const;
 };
 
+// How a select/update/remove found its rows, filled in when requested
+struct ScanStats {
+    const char* access_path = "none";  // "pk_index", "hash_index", "btree_index", "art_index",
+                                       // "bitmap_index", "composite_index", "index_only_scan"
+                                       // (composite index without reading rows), "index_union"
+                                       // (OR branches each planned on an index), "zone_scan"
+                                       // (full scan that skipped blocks) or "full_scan"
+    size_t rows_examined = 0;          // Rows whose conditions were evaluated
+    size_t rows_matched = 0;
+};
+
+class Index;
+struct IndexDef;
+class ZoneMap;
+
+// Row positions (in rows_) produced by an index lookup
+using RowPositions = std::vector<size_t>;
+
+// Row counts and approximate memory use of a table, for SHOW TABLE STATUS
+struct TableStatus {
+    StorageEngine engine = StorageEngine::Heap;
+    size_t row_count = 0;
+    size_t data_bytes = 0;      // rows_ and the values and strings it owns (LSM: memtables)
+    size_t index_bytes = 0;     // Primary key, secondary indexes and zone map (LSM: run indexes and filters)
+    size_t disk_bytes = 0;      // LSM run files
+    size_t secondary_indexes = 0;
+    storage::BPlusTreeStats index;
+};
+
 // Table class representing a single database table
 class Table {
 public:
-    Table(const std::string& name, const std::vector<ColumnDef>& columns);
+    // LSM tables need an INT or TEXT primary key (see Database::create_table)
+    Table(const std::string& name, const std::vector<ColumnDef>& columns,
+          StorageEngine engine = StorageEngine::Heap);
+    ~Table();
 
     const std::string& name() const { return name_; }
     const std::vector<ColumnDef>& columns() const { return columns_; }
+    StorageEngine engine() const { return engine_; }
 
     // Insert a row
     bool insert_row(const Row& row);
     
     // Select rows matching the conditions
-    std::vector<Row> select(const std::vector<Condition>& conditions = {}) const;
+    std::vector<Row> select(const Conditions& conditions = {},
+                            ScanStats* stats = nullptr) const;
+    
+    // Select rows matching the conditions, keeping only the columns at the
+    // projection's positions, in its order. Answered from a composite index
+    // alone when it stores every column the query touches.
+    std::vector<Row> select(const Conditions& conditions,
+                            const std::vector<size_t>& projection,
+                            ScanStats* stats = nullptr) const;
+    
+    // Rows with the given primary keys, in the order of keys and nullopt
+    // where there is none, from one batched probe of the primary key index
+    std::vector<std::optional<Row>> get_rows(const std::vector<DBValue>& keys) const;
     
     // Update rows matching the conditions
     size_t update(const std::unordered_map<std::string, DBValue>& updates, 
-                  const std::vector<Condition>& conditions = {});
+                  const Conditions& conditions = {},
+                  ScanStats* stats = nullptr);
     
     // Delete rows matching the conditions
-    size_t remove(const std::vector<Condition>& conditions = {});
+    size_t remove(const Conditions& conditions = {},
+                  ScanStats* stats = nullptr);
     
     // Get the index of a column by name
     std::optional<size_t> column_index(const std::string& name) const;
+    
+    // Walk the rows and index to measure their memory use
+    TableStatus status() const;
+    
+    // Build a secondary index over the existing rows
+    bool create_index(const IndexDef& def);
+    
+    // Enable or disable the primary key Bloom filter (on by default)
+    void set_key_filter(bool enabled);
 
 private:
     std::string name_;
     std::vector<ColumnDef> columns_;
-    std::vector<Row> rows_;
+    std::vector<Row> rows_;             // A deleted row is left empty until compact_rows
+    size_t dead_rows_ = 0;
     std::optional<size_t> primary_key_index_;
     
     // B+ tree index for primary key if available
     std::unique_ptr<storage::BPlusTree<DBInt, size_t>> int_index_;
     std::unique_ptr<storage::BPlusTree<DBText, size_t>> text_index_;
     
-    bool row_matches(const Row& row, const std::vector<Condition>& conditions) const;
+    // Answers "definitely absent" for most missing primary keys so lookups
+    // and duplicate checks can skip the tree descent
+    storage::BloomFilter key_filter_;
+    bool key_filter_enabled_ = true;
+    
+    // Secondary indexes, maintained on every write
+    std::vector<std::unique_ptr<Index>> indexes_;
+    
+    // Per-block column bounds that let full scans skip blocks of rows_
+    std::unique_ptr<ZoneMap> zone_map_;
+    
+    // LSM engine: rows encoded by primary key instead of rows_ and indexes
+    StorageEngine engine_;
+    std::unique_ptr<storage::LsmTree> lsm_;
+    size_t lsm_rows_ = 0;
+    
+    // Guards rows_ and the indexes; selects share it, writers hold it exclusively
+    mutable std::shared_mutex mutex_;
+    
+    bool row_matches(const Row& row, const Conditions& conditions) const;
     void update_index(const DBValue& key, size_t row_index);
+    void remove_from_pk_index(const DBValue& key);
+    // Drop deleted rows, shifting the rest down, and rebuild every index
+    void compact_rows();
+    void rebuild_indexes();
+    void rebuild_key_filter();
+    
+    // The primary key equality a lookup can use, if any
+    const Condition* pk_condition(const Conditions& conditions) const;
+    
+    // Row position for a primary key, consulting the Bloom filter first
+    std::optional<size_t> find_pk(const DBValue& key) const;
+    // find_pk for many keys, sharing one find_many per key tree; keys of a
+    // type the index does not hold are looked up by scanning
+    std::vector<std::optional<size_t>> find_pks(const std::vector<DBValue>& keys) const;
+    
+    // Candidate rows for the conditions from the best usable index, or
+    // nullopt when only a full scan can answer them
+    std::optional<RowPositions> plan(const Conditions& conditions,
+                                     const char** access_path) const;
+    // Positions of rows in the intersection of the bitmap indexes'
+    // answers for every condition they cover, in table order
+    RowPositions bitmap_plan(const Conditions& conditions, const char** access_path) const;
+    // Sorted union of the plans for each branch of the first OR condition
+    // whose branches can all use an index; nullopt if there is none
+    std::optional<RowPositions> union_plan(const Conditions& conditions,
+                                           const char** access_path) const;
+    // Index-only answer to a projected select; false if no covering index
+    // is the best plan, leaving result untouched
+    bool select_covering(const Conditions& conditions, const std::vector<size_t>& projection,
+                         std::vector<Row>& result, ScanStats* stats) const;
     bool has_index() const { return primary_key_index_.has_value(); }
+    
+    // Full scan: call func with the position of every row in a block the
+    // zone map cannot rule out; returns how many rows were visited
+    size_t scan_rows(const Conditions& conditions, const char** access_path,
+                     const std::function<void(size_t)>& func) const;
+    
+    // LSM engine operations (lsm_table.cpp), called with the lock held.
+    void open_lsm();
+    // lsm_scan calls func on each row matching the conditions and returns
+    // how many rows it examined.
+    bool lsm_insert(const Row& row);
+    size_t lsm_scan(const Conditions& conditions, const char** access_path,
+                    const std::function<void(Row&)>& func) const;
+    size_t lsm_update(const std::unordered_map<size_t, DBValue>& updates,
+                      const Conditions& conditions, const char** access_path,
+                      size_t* examined);
+    size_t lsm_remove(const Conditions& conditions, const char** access_path,
+                      size_t* examined);
 };
 
 } // namespace db
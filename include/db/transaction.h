@@ -0,0 +1,74 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include "table.h"
+
+namespace toydb {
+namespace db {
+
+class Transaction {
+public:
+    enum class State {
+        ACTIVE,
+        COMMITTED,
+        ABORTED
+    };
+
+    Transaction(uint64_t id)
+        : id_(id), state_(State::ACTIVE), start_time_(std::chrono::steady_clock::now()) {}
+
+    void add_table_state(const std::string& table_name,
+                        const std::vector<Row>& state) {
+        table_states_[table_name] = state;
+    }
+
+    const std::vector<Row>& get_table_state(
+        const std::string& table_name) const {
+        auto it = table_states_.find(table_name);
+        if (it == table_states_.end()) {
+            throw std::runtime_error("No state found for table " + table_name);
+        }
+        return it->second;
+    }
+
+    void set_state(State state) { state_ = state; }
+    State state() const { return state_; }
+    uint64_t id() const { return id_; }
+    std::chrono::steady_clock::time_point start_time() const { return start_time_; }
+
+private:
+    uint64_t id_;
+    State state_;
+    std::chrono::steady_clock::time_point start_time_;
+    std::unordered_map<std::string, std::vector<Row>> table_states_;
+};
+
+class TransactionManager {
+public:
+    static TransactionManager& instance();
+
+    uint64_t begin_transaction();
+    void commit_transaction(uint64_t id);
+    void abort_transaction(uint64_t id);
+    Transaction& get_transaction(uint64_t id);
+
+private:
+    TransactionManager() : next_transaction_id_(1) {}
+    ~TransactionManager() = default;
+    TransactionManager(const TransactionManager&) = delete;
+    TransactionManager& operator=(const TransactionManager&) = delete;
+
+    std::mutex mutex_;
+    uint64_t next_transaction_id_;
+    std::unordered_map<uint64_t, std::unique_ptr<Transaction>> transactions_;
+};
+
+} // namespace db
+} // namespace toydb
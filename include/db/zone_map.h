@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include "table.h"
+
+namespace toydb {
+namespace db {
+
+// Per-block summaries of a heap table's rows, used to skip blocks of a full
+// scan that cannot hold a matching row. Rows are grouped by position into
+// blocks of kBlockRows; for every column each block keeps the smallest and
+// largest non-NULL value and the NULL count.
+//
+// Bounds only ever widen: updates grow them to cover the new value but do
+// not shrink them when the old extreme goes away, so a block may be scanned
+// needlessly but is never skipped wrongly. Removing rows shifts positions,
+// so the table rebuilds the map after deletes, which also tightens it.
+class ZoneMap {
+public:
+    static constexpr size_t kBlockRows = 1024;
+
+    // Conditions resolved to column positions, for may_match
+    using Predicates = std::vector<std::pair<size_t, const Condition*>>;
+
+    explicit ZoneMap(size_t columns) : columns_(columns) {}
+
+    // Record the row appended at position (the table's row count before it)
+    void add(const Row& row, size_t position);
+
+    // Record a change to one column of the row at position
+    void update(size_t position, size_t column, const DBValue& before, const DBValue& after);
+
+    void clear() { blocks_.clear(); }
+
+    size_t blocks() const { return blocks_.size(); }
+
+    // The conditions the map can prune with; empty if none can
+    Predicates predicates(const Conditions& conditions,
+                          const std::vector<ColumnDef>& columns) const;
+
+    // False if no row in the block can satisfy every predicate
+    bool may_match(size_t block, const Predicates& predicates) const;
+
+    // Approximate bytes held by the summaries
+    size_t memory_bytes() const;
+
+private:
+    struct ColumnZone {
+        DBValue min;        // Meaningless while the block has no non-NULL value
+        DBValue max;
+        size_t nulls = 0;
+    };
+
+    struct Block {
+        size_t rows = 0;
+        std::vector<ColumnZone> columns;
+    };
+
+    size_t columns_;
+    std::vector<Block> blocks_;
+
+    // Grow the zone's bounds to cover a non-NULL value
+    static void widen(ColumnZone& zone, const DBValue& value, bool has_values);
+};
+
+} // namespace db
+} // namespace toydb
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace toydb {
+namespace metrics {
+
+// Counters are split into per-thread shards so concurrent writers do not
+// contend on one cache line; histograms use fewer, larger shards
+constexpr size_t kCounterShards = 16;
+constexpr size_t kHistogramShards = 4;
+
+// Shard assigned to the calling thread (round-robin on first use)
+size_t next_shard();
+
+inline size_t shard_index() {
+    thread_local size_t index = next_shard();
+    return index;
+}
+
+// Monotonic counter; add() is a relaxed atomic increment on the caller's shard
+class Counter {
+public:
+    void add(uint64_t n = 1) {
+        shards_[shard_index() % kCounterShards].value.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const;
+    void reset();
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{0};
+    };
+    std::array<Shard, kCounterShards> shards_;
+};
+
+// Point-in-time copy of a histogram
+struct HistogramSnapshot {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    std::vector<uint64_t> buckets;
+
+    double mean() const { return count ? static_cast<double>(sum) / count : 0.0; }
+
+    // Value at quantile q in [0, 1]; exact to within the bucket width (~6%)
+    uint64_t percentile(double q) const;
+};
+
+// HDR-style log-linear histogram of non-negative values (nanoseconds for
+// latencies). Each power of two is split into 16 linear sub-buckets, so the
+// relative error is bounded at every scale. Values above 2^40 are clamped.
+class Histogram {
+public:
+    static constexpr unsigned kSubBucketBits = 4;
+    static constexpr unsigned kSubBuckets = 1u << kSubBucketBits;
+    static constexpr unsigned kMaxExponent = 40;
+    static constexpr size_t kBucketCount = kSubBuckets * (kMaxExponent - kSubBucketBits + 2);
+
+    void record(uint64_t value);
+
+    HistogramSnapshot snapshot() const;
+    void reset();
+
+    static size_t bucket_index(uint64_t value);
+    // Largest value that falls into a bucket
+    static uint64_t bucket_upper_bound(size_t index);
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sum{0};
+        std::atomic<uint64_t> max{0};
+        std::array<std::atomic<uint64_t>, kBucketCount> buckets{};
+    };
+    std::array<Shard, kHistogramShards> shards_;
+};
+
+// Latency sampling: 0 = off, 1 = every operation, N = one in N.
+// Defaults to the TOYDB_METRICS_SAMPLE environment variable, or 1.
+void set_sample_rate(uint32_t rate);
+uint32_t sample_rate();
+
+extern std::atomic<uint32_t> g_sample_rate;
+
+inline bool should_sample() {
+    uint32_t rate = g_sample_rate.load(std::memory_order_relaxed);
+    if (rate <= 1) {
+        return rate == 1;
+    }
+    thread_local uint32_t tick = 0;
+    return ++tick % rate == 0;
+}
+
+// Records the lifetime of the scope into a histogram when sampled; when
+// sampling is off the clock is never read
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Histogram& histogram)
+        : histogram_(should_sample() ? &histogram : nullptr) {
+        if (histogram_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedTimer() {
+        if (histogram_) {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            histogram_->record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram* histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Process-wide set of named metrics. Registration takes a lock; call sites
+// look their metrics up once and keep the reference, so updates never do.
+class Registry {
+public:
+    static Registry& instance();
+
+    Counter& counter(const std::string& name);
+    Histogram& histogram(const std::string& name);
+
+    // One (name, value) pair per counter and per histogram, sorted by name;
+    // histograms are summarized with their latency percentiles
+    std::vector<std::pair<std::string, std::string>> rows() const;
+
+    // Text dump of rows(), one "name value" line each
+    void dump(std::ostream& out) const;
+
+    void reset();
+
+private:
+    Registry();
+
+    mutable std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<Counter>> counters_;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms_;
+};
+
+inline Counter& counter(const std::string& name) {
+    return Registry::instance().counter(name);
+}
+
+inline Histogram& histogram(const std::string& name) {
+    return Registry::instance().histogram(name);
+}
+
+} // namespace metrics
+} // namespace toydb
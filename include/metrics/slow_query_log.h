@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace toydb {
+namespace metrics {
+
+// Where the time of one statement went
+struct QueryProfile {
+    std::string sql;
+    std::chrono::nanoseconds parse{0};
+    std::chrono::nanoseconds convert{0};   // Parser values/conditions to DB values
+    std::chrono::nanoseconds execute{0};   // Table access
+    std::chrono::nanoseconds format{0};    // Printing or encoding the result
+    std::chrono::nanoseconds total{0};
+    const char* access_path = "none";
+    size_t rows_examined = 0;
+    size_t rows_returned = 0;
+};
+
+// Adds the lifetime of the scope to a phase of a profile; a null phase
+// makes it a no-op so callers do not time anything when logging is off
+class PhaseTimer {
+public:
+    explicit PhaseTimer(std::chrono::nanoseconds* phase) : phase_(phase) {
+        if (phase_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~PhaseTimer() {
+        if (phase_) {
+            *phase_ += std::chrono::steady_clock::now() - start_;
+        }
+    }
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    std::chrono::nanoseconds* phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Replace literals with '?' and collapse whitespace so that statements that
+// differ only in their constants log identically
+std::string normalize_sql(const std::string& sql);
+
+// Appends statements slower than a threshold to a file, one line each.
+// Entries are handed to a background writer through a bounded queue, so
+// record() never waits for file I/O; entries are dropped if it is full.
+//
+// The process-wide instance is configured from TOYDB_SLOW_QUERY_LOG (file
+// path) and TOYDB_SLOW_QUERY_MS (threshold, default 100 ms).
+class SlowQueryLog {
+public:
+    static SlowQueryLog& instance();
+
+    SlowQueryLog() = default;
+    ~SlowQueryLog();
+
+    SlowQueryLog(const SlowQueryLog&) = delete;
+    SlowQueryLog& operator=(const SlowQueryLog&) = delete;
+
+    // Start logging to path (appending); returns false if it cannot be opened
+    bool open(const std::string& path, std::chrono::microseconds threshold);
+
+    // Write out queued entries and stop the writer
+    void close();
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+    std::chrono::microseconds threshold() const { return threshold_; }
+
+    // Queue the profile if its total time reached the threshold
+    void record(QueryProfile profile);
+
+    uint64_t dropped() const;
+
+private:
+    static constexpr size_t kMaxQueued = 4096;
+
+    std::atomic<bool> enabled_{false};
+    std::chrono::microseconds threshold_{0};
+    std::ofstream file_;
+    std::thread writer_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::pair<std::chrono::system_clock::time_point, QueryProfile>> queue_;
+    bool stopping_ = false;
+    uint64_t dropped_ = 0;
+
+    void run_writer();
+};
+
+} // namespace metrics
+} // namespace toydb
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace toydb {
+namespace metrics {
+
+// Trace spans are compiled in only with -DTOYDB_TRACING=ON; otherwise the
+// TOYDB_TRACE_SPAN macro expands to nothing and costs nothing
+#ifdef TOYDB_TRACING
+constexpr bool kTracingEnabled = true;
+#else
+constexpr bool kTracingEnabled = false;
+#endif
+
+// One completed span. Names and categories must be string literals.
+struct TraceEvent {
+    const char* name = nullptr;
+    const char* category = nullptr;
+    uint64_t start_ns = 0;
+    uint64_t duration_ns = 0;
+};
+
+// Fixed-size ring of a single thread's most recent spans. Only the owning
+// thread writes; the exporter reads up to the published head, so exporting
+// while spans are recorded may show a few half-overwritten oldest events.
+class TraceBuffer {
+public:
+    static constexpr size_t kCapacity = 1 << 14;
+
+    explicit TraceBuffer(uint32_t thread_id) : thread_id_(thread_id) {}
+
+    void push(const TraceEvent& event) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        events_[head % kCapacity] = event;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    uint32_t thread_id() const { return thread_id_; }
+    uint64_t head() const { return head_.load(std::memory_order_acquire); }
+    const TraceEvent& at(uint64_t i) const { return events_[i % kCapacity]; }
+
+    void clear() { head_.store(0, std::memory_order_release); }
+
+private:
+    uint32_t thread_id_;
+    std::atomic<uint64_t> head_{0};
+    std::array<TraceEvent, kCapacity> events_;
+};
+
+// Nanoseconds since the first call in this process
+uint64_t trace_now_ns();
+
+// Ring buffer of the calling thread, registered on first use
+TraceBuffer& thread_trace_buffer();
+
+// Write every buffered span as Chrome trace JSON (chrome://tracing, Perfetto)
+void write_chrome_trace(std::ostream& out);
+
+// Same, to a file; returns false if it cannot be written
+bool write_chrome_trace(const std::string& path);
+
+// Drop all buffered spans; call while no spans are being recorded
+void clear_trace();
+
+// Records the lifetime of a scope as a complete ("X") event
+class TraceSpan {
+public:
+    TraceSpan(const char* name, const char* category)
+        : name_(name), category_(category), start_ns_(trace_now_ns()) {}
+
+    ~TraceSpan() {
+        thread_trace_buffer().push({name_, category_, start_ns_, trace_now_ns() - start_ns_});
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* name_;
+    const char* category_;
+    uint64_t start_ns_;
+};
+
+} // namespace metrics
+} // namespace toydb
+
+#define TOYDB_TRACE_CONCAT_INNER(a, b) a##b
+#define TOYDB_TRACE_CONCAT(a, b) TOYDB_TRACE_CONCAT_INNER(a, b)
+
+#ifdef TOYDB_TRACING
+#define TOYDB_TRACE_SPAN(name, category) \
+    ::toydb::metrics::TraceSpan TOYDB_TRACE_CONCAT(toydb_trace_span_, __LINE__)(name, category)
+#else
+#define TOYDB_TRACE_SPAN(name, category) ((void)0)
+#endif
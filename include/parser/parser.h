@@ -1,23 +1,29 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <optional>
 #include <variant>
 #include "../db/table.h"
+#include "../db/index.h"
+#include "../db/query_arena.h"
 
 namespace toydb {
 namespace parser {
 
 // Forward declarations
 struct CreateTableStmt;
+struct CreateIndexStmt;
 struct InsertStmt;
 struct SelectStmt;
 struct UpdateStmt;
 struct DeleteStmt;
 struct DropTableStmt;
 struct ShowTablesStmt;
+struct ShowMetricsStmt;
+struct ShowTableStatusStmt;
 struct BeginTransactionStmt;
 struct CommitTransactionStmt;
 struct AbortTransactionStmt;
@@ -25,12 +31,15 @@ struct AbortTransactionStmt;
 // Statement is a variant of all possible statement types
 using Statement = std::variant<
     CreateTableStmt,
+    CreateIndexStmt,
     InsertStmt,
     SelectStmt,
     UpdateStmt,
     DeleteStmt,
     DropTableStmt,
     ShowTablesStmt,
+    ShowMetricsStmt,
+    ShowTableStatusStmt,
     BeginTransactionStmt,
     CommitTransactionStmt,
     AbortTransactionStmt
@@ -48,6 +57,26 @@ struct ColumnDefinition {
 struct CreateTableStmt {
     std::string table_name;
     std::vector<ColumnDefinition> columns;
+    std::string engine = "HEAP"; // ENGINE [=] HEAP | LSM
+};
+
+// WHERE condition
+struct Condition {
+    std::string column;
+    std::string op; // =, >, <, >=, <=, !=, IN, OR
+    std::string value;
+    std::vector<std::string> values;            // IN (v, ...)
+    std::vector<std::vector<Condition>> any_of; // OR: AND-ed branches
+};
+
+// CREATE INDEX statement
+struct CreateIndexStmt {
+    std::string index_name;
+    std::string table_name;
+    std::vector<std::string> columns;
+    std::vector<std::string> include; // INCLUDE (col, ...)
+    std::string method = "BTREE"; // USING BTREE | HASH | ART | BITMAP
+    std::vector<Condition> conditions; // WHERE predicate of a partial index
 };
 
 // INSERT statement
@@ -57,13 +86,6 @@ struct InsertStmt {
     std::vector<std::vector<std::string>> values; // For multi-row inserts
 };
 
-// WHERE condition
-struct Condition {
-    std::string column;
-    std::string op; // =, >, <, >=, <=, !=
-    std::string value;
-};
-
 // SELECT statement
 struct SelectStmt {
     std::vector<std::string> columns; // * is represented as empty vector
@@ -94,6 +116,16 @@ struct ShowTablesStmt {
     // No additional fields needed
 };
 
+// SHOW METRICS statement
+struct ShowMetricsStmt {
+    // No additional fields needed
+};
+
+// SHOW TABLE STATUS statement
+struct ShowTableStatusStmt {
+    // No additional fields needed
+};
+
 // BEGIN TRANSACTION statement
 struct BeginTransactionStmt {
     // No additional fields needed
@@ -109,6 +141,9 @@ struct AbortTransactionStmt {
     uint64_t transaction_id;
 };
 
+// Tokens of one statement, as views into the SQL text
+using TokenList = std::pmr::vector<std::string_view>;
+
 // Parser class
 class Parser {
 public:
@@ -121,33 +156,55 @@ public:
     std::string last_error() const { return error_; }
 
 private:
+    // Dispatch on the leading keyword; parse() wraps it with metrics
+    std::optional<Statement> parse_statement(const std::string& sql);
+    
     // Helper functions for parsing specific statements
-    std::optional<CreateTableStmt> parse_create_table(std::vector<std::string>& tokens);
-    std::optional<InsertStmt> parse_insert(std::vector<std::string>& tokens);
-    std::optional<SelectStmt> parse_select(std::vector<std::string>& tokens);
-    std::optional<UpdateStmt> parse_update(std::vector<std::string>& tokens);
-    std::optional<DeleteStmt> parse_delete(std::vector<std::string>& tokens);
-    std::optional<DropTableStmt> parse_drop_table(std::vector<std::string>& tokens);
-    std::optional<ShowTablesStmt> parse_show_tables(std::vector<std::string>& tokens);
-    std::optional<BeginTransactionStmt> parse_begin_transaction(std::vector<std::string>& tokens);
-    std::optional<CommitTransactionStmt> parse_commit_transaction(std::vector<std::string>& tokens);
-    std::optional<AbortTransactionStmt> parse_abort_transaction(std::vector<std::string>& tokens);
+    std::optional<CreateTableStmt> parse_create_table(TokenList& tokens);
+    std::optional<CreateIndexStmt> parse_create_index(TokenList& tokens);
+    std::optional<InsertStmt> parse_insert(TokenList& tokens);
+    std::optional<SelectStmt> parse_select(TokenList& tokens);
+    std::optional<UpdateStmt> parse_update(TokenList& tokens);
+    std::optional<DeleteStmt> parse_delete(TokenList& tokens);
+    std::optional<DropTableStmt> parse_drop_table(TokenList& tokens);
+    std::optional<ShowTablesStmt> parse_show_tables(TokenList& tokens);
+    std::optional<ShowMetricsStmt> parse_show_metrics(TokenList& tokens);
+    std::optional<ShowTableStatusStmt> parse_show_table_status(TokenList& tokens);
+    std::optional<BeginTransactionStmt> parse_begin_transaction(TokenList& tokens);
+    std::optional<CommitTransactionStmt> parse_commit_transaction(TokenList& tokens);
+    std::optional<AbortTransactionStmt> parse_abort_transaction(TokenList& tokens);
+    
+    // Tokenize the SQL statement; tokens view into sql and the list lives
+    // in scratch_ until the end of parse()
+    TokenList tokenize(const std::string& sql);
     
-    // Tokenize the SQL statement
-    std::vector<std::string> tokenize(const std::string& sql);
+    // Helper to parse WHERE conditions; empty on a syntax error
+    std::vector<Condition> parse_conditions(TokenList& tokens);
     
-    // Helper to parse WHERE conditions
-    std::vector<Condition> parse_conditions(std::vector<std::string>& tokens);
+    // WHERE grammar, each appending AND-ed conditions to out: OR binds
+    // looser than AND and parentheses group; false on a syntax error
+    bool parse_disjunction(TokenList& tokens, std::vector<Condition>& out);
+    bool parse_conjunction(TokenList& tokens, std::vector<Condition>& out);
+    bool parse_predicate(TokenList& tokens, std::vector<Condition>& out);
     
     // Error handling
     std::string error_;
+    
+    // Per-statement scratch memory, released when parse() returns
+    db::QueryArena scratch_;
 };
 
 // Helper functions to convert from parser types to DB types
 db::ColumnType string_to_column_type(const std::string& type_str);
 db::ColumnDef convert_column_def(const ColumnDefinition& col_def);
+db::IndexDef convert_index_def(const CreateIndexStmt& stmt,
+                               const std::vector<db::ColumnDef>& columns);
+db::StorageEngine convert_storage_engine(const CreateTableStmt& stmt);
 db::DBValue parse_value(const std::string& value_str, db::ColumnType expected_type);
 db::Condition convert_condition(const Condition& cond, const std::vector<db::ColumnDef>& columns);
+db::Row convert_row(const std::vector<std::string>& value_strs,
+                    const std::vector<db::ColumnDef>& columns,
+                    const std::vector<std::string>& col_names = {});
 
 } // namespace parser
 } // namespace toydb 
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include "../db/table.h"
+
+namespace toydb {
+namespace server {
+
+// Wire protocol
+//
+// Every message is a frame: a 4-byte big-endian length (covering the type
+// byte and the payload), a 1-byte message type and the payload. Integers are
+// big-endian, strings are a 4-byte length followed by the raw bytes.
+//
+// Values are tagged with one byte (see ValueTag) followed by the encoded value.
+
+// Messages sent by the client
+enum class ClientMessage : uint8_t {
+    Query = 'Q',     // sql
+    Prepare = 'P',   // u32 statement id, sql with '?' placeholders
+    Execute = 'E',   // u32 statement id, u16 param count, values
+    Close = 'C',     // u32 statement id
+    Terminate = 'X'  // no payload
+};
+
+// Messages sent by the server
+enum class ServerMessage : uint8_t {
+    RowDescription = 'T', // u16 column count, (string name, u8 column type)...
+    RowBatch = 'D',       // u32 row count, values...
+    Complete = 'K',       // u64 affected/returned rows, string message
+    PrepareOk = '1',      // u32 statement id, u16 param count
+    Error = 'R'           // string message
+};
+
+enum class ValueTag : uint8_t {
+    Null = 0,
+    Int = 1,
+    Float = 2,
+    Text = 3
+};
+
+// Size of the frame header (length + type)
+constexpr size_t kFrameHeaderSize = 5;
+
+// Frames larger than this are rejected and the connection is closed
+constexpr uint32_t kMaxFrameSize = 64 * 1024 * 1024;
+
+// Number of rows sent per RowBatch message
+constexpr size_t kRowBatchSize = 256;
+
+// A decoded frame
+struct Frame {
+    uint8_t type;
+    std::string payload;
+};
+
+// Appends encoded data to a buffer
+class Encoder {
+public:
+    explicit Encoder(std::string& out) : out_(out) {}
+
+    void put_u8(uint8_t v);
+    void put_u16(uint16_t v);
+    void put_u32(uint32_t v);
+    void put_u64(uint64_t v);
+    void put_string(const std::string& s);
+    void put_value(const db::DBValue& value);
+
+    // Start a frame of the given type; returns its offset for end_frame
+    size_t begin_frame(uint8_t type);
+    // Patch the length of a frame started with begin_frame
+    void end_frame(size_t frame_start);
+
+private:
+    std::string& out_;
+};
+
+// Reads encoded data from a payload; all getters return false on underflow
+class Decoder {
+public:
+    Decoder(const char* data, size_t size) : data_(data), size_(size), pos_(0) {}
+    explicit Decoder(const std::string& s) : Decoder(s.data(), s.size()) {}
+
+    bool get_u8(uint8_t& v);
+    bool get_u16(uint16_t& v);
+    bool get_u32(uint32_t& v);
+    bool get_u64(uint64_t& v);
+    bool get_string(std::string& s);
+    bool get_value(db::DBValue& value);
+
+    // Remaining bytes as a string (used for SQL text)
+    std::string rest();
+    size_t remaining() const { return size_ - pos_; }
+
+private:
+    const char* data_;
+    size_t size_;
+    size_t pos_;
+};
+
+// Try to extract one complete frame from the start of a buffer.
+// Returns the number of bytes consumed (0 if the frame is incomplete) or
+// std::nullopt if the frame header is invalid.
+std::optional<size_t> read_frame(const char* data, size_t size, Frame& frame);
+
+// Helpers to build complete server messages
+void write_row_description(std::string& out, const std::vector<db::ColumnDef>& columns);
+void write_row_batch(std::string& out, const std::vector<db::Row>& rows,
+                     size_t begin, size_t end);
+void write_complete(std::string& out, uint64_t count, const std::string& message);
+void write_prepare_ok(std::string& out, uint32_t statement_id, uint16_t param_count);
+void write_error(std::string& out, const std::string& message);
+
+} // namespace server
+} // namespace toydb
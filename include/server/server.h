@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "../db/database.h"
+#include "session.h"
+
+namespace toydb {
+namespace server {
+
+struct ServerOptions {
+    std::string host = "127.0.0.1";
+    uint16_t port = 7878;
+    std::string unix_socket; // If set, listen on this Unix socket instead of TCP
+    int max_events = 256;    // Events handled per epoll_wait call
+    size_t max_pipeline_depth = 1024;             // Frames handled per batch
+    size_t max_pending_output = 4 * 1024 * 1024;  // Stop reading above this
+    size_t max_read_per_event = 1024 * 1024;      // Bytes read per readable event
+};
+
+// A client connection and its buffered I/O
+struct Connection {
+    int fd;
+    Session session;
+    std::string read_buffer;
+    std::string write_buffer;
+    size_t write_offset = 0; // Bytes of write_buffer already sent
+    bool closing = false;    // Close once the write buffer is drained
+    bool read_closed = false; // Peer shut down its side; answer what was sent, then close
+    uint32_t events = 0;     // Currently registered epoll events
+
+    Connection(int fd, std::shared_ptr<db::Database> db) : fd(fd), session(std::move(db)) {}
+};
+
+// Single-threaded epoll event loop serving the wire protocol
+class Server {
+public:
+    Server(std::shared_ptr<db::Database> db, ServerOptions options);
+    ~Server();
+
+    // Bind the listening socket and run the event loop until stop() is called
+    void run();
+
+    // Ask the event loop to exit; safe to call from a signal handler
+    void stop();
+
+private:
+    std::shared_ptr<db::Database> db_;
+    ServerOptions options_;
+    int listen_fd_ = -1;
+    int epoll_fd_ = -1;
+    int wakeup_fd_ = -1;
+    std::atomic<bool> running_{false};
+    std::unordered_map<int, std::unique_ptr<Connection>> connections_;
+    std::vector<Frame> frames_; // Reused batch of decoded frames
+
+    void listen();
+    void accept_connections();
+    void handle_readable(Connection& conn);
+    void handle_writable(Connection& conn);
+    // Execute buffered requests; returns false if the connection was closed
+    bool process_frames(Connection& conn);
+    bool flush(Connection& conn);
+    void update_interest(Connection& conn);
+    void close_connection(int fd);
+};
+
+} // namespace server
+} // namespace toydb
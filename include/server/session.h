@@ -0,0 +1,114 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <unordered_map>
+#include "../db/database.h"
+#include "../parser/parser.h"
+#include "../metrics/slow_query_log.h"
+#include "protocol.h"
+
+namespace toydb {
+namespace server {
+
+// Prepared `SELECT ... WHERE column = ?` with no other predicates; executed
+// without re-binding the parsed statement
+struct PointLookup {
+    std::string table_name;
+    std::string column_name;
+    std::vector<std::string> columns;   // Selected columns, empty for SELECT *
+};
+
+// A statement parsed once by Prepare and bound on every Execute
+struct PreparedStatement {
+    parser::Statement statement;
+    uint16_t param_count = 0;
+    std::optional<PointLookup> point_lookup;
+};
+
+// Per-connection protocol state: parses and executes requests and encodes
+// the responses into an output buffer
+class Session {
+public:
+    explicit Session(std::shared_ptr<db::Database> db);
+
+    // Handle one request frame, appending the response to out.
+    // Returns false if the client asked to close the connection.
+    bool handle_frame(const Frame& frame, std::string& out);
+
+    // Handle a batch of pipelined frames in order, appending all responses
+    // to out. Runs of point lookups are executed back-to-back.
+    // Returns false if the client asked to close the connection.
+    bool handle_frames(const std::vector<Frame>& frames, std::string& out);
+
+private:
+    std::shared_ptr<db::Database> db_;
+    parser::Parser parser_;
+
+    // Temporaries of the statement being executed
+    db::QueryArena arena_;
+    std::unordered_map<uint32_t, PreparedStatement> prepared_;
+
+    // Profile of the current simple query; only filled in while the slow
+    // query log is enabled
+    metrics::QueryProfile profile_;
+    bool profiling_ = false;
+
+    std::chrono::nanoseconds* phase(std::chrono::nanoseconds metrics::QueryProfile::*member) {
+        return profiling_ ? &(profile_.*member) : nullptr;
+    }
+
+    // Copy the access path and row counts of a table call into the profile
+    void record_scan(const db::ScanStats& stats, size_t rows_returned);
+
+    // Handle specific request types
+    void handle_query(const std::string& sql, std::string& out);
+    void handle_prepare(Decoder& dec, std::string& out);
+    void handle_execute(Decoder& dec, std::string& out);
+    void handle_close(Decoder& dec, std::string& out);
+
+    // Execute a run of Execute frames that all target the same point lookup
+    void execute_point_lookups(const PointLookup& lookup,
+                               const std::vector<Frame>& frames,
+                               size_t begin, size_t end, std::string& out);
+
+    // Execute a parsed statement and encode its result
+    void execute(const parser::Statement& statement, std::string& out);
+
+    // Handle specific statement types
+    void handle_create_table(const parser::CreateTableStmt& stmt, std::string& out);
+    void handle_create_index(const parser::CreateIndexStmt& stmt, std::string& out);
+    void handle_insert(const parser::InsertStmt& stmt, std::string& out);
+    void handle_select(const parser::SelectStmt& stmt, std::string& out);
+    void handle_update(const parser::UpdateStmt& stmt, std::string& out);
+    void handle_delete(const parser::DeleteStmt& stmt, std::string& out);
+    void handle_drop_table(const parser::DropTableStmt& stmt, std::string& out);
+    void handle_show_tables(const parser::ShowTablesStmt& stmt, std::string& out);
+    void handle_show_metrics(const parser::ShowMetricsStmt& stmt, std::string& out);
+    void handle_show_table_status(const parser::ShowTableStatusStmt& stmt, std::string& out);
+    void handle_begin_transaction(const parser::BeginTransactionStmt& stmt, std::string& out);
+    void handle_commit_transaction(const parser::CommitTransactionStmt& stmt, std::string& out);
+    void handle_abort_transaction(const parser::AbortTransactionStmt& stmt, std::string& out);
+
+    // Encode a full result set (description, row batches, completion)
+    void write_rows(const std::vector<db::Row>& rows,
+                    const std::vector<db::ColumnDef>& columns, std::string& out);
+};
+
+// Detect statements eligible for the point lookup fast path
+std::optional<PointLookup> as_point_lookup(const parser::Statement& statement);
+
+// Collect the '?' placeholders of a statement in bind order
+std::vector<std::string*> collect_placeholders(parser::Statement& statement);
+
+// Render a bound parameter as the literal text the parser expects
+std::string param_to_literal(const db::DBValue& value);
+
+// A bound parameter as the value binding it into a statement would produce
+// for a column of the given type
+db::DBValue coerce_param(const db::DBValue& value, db::ColumnType type);
+
+} // namespace server
+} // namespace toydb
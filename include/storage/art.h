@@ -0,0 +1,753 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "bplustree.h"
+#include "../metrics/metrics.h"
+#include "../metrics/trace.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace toydb {
+namespace storage {
+
+// Operation counters shared by every radix tree instance
+struct ArtMetrics {
+    metrics::Counter& inserts;
+    metrics::Counter& finds;
+    metrics::Counter& updates;
+    metrics::Counter& removes;
+    metrics::Counter& range_scans;
+    metrics::Counter& node_grows;
+};
+
+inline ArtMetrics& art_metrics() {
+    static ArtMetrics m{
+        metrics::counter("art.insert"),
+        metrics::counter("art.find"),
+        metrics::counter("art.update"),
+        metrics::counter("art.remove"),
+        metrics::counter("art.range_scan"),
+        metrics::counter("art.node_grows"),
+    };
+    return m;
+}
+
+// Turns keys into byte strings whose memcmp order is the key order. The
+// encodings must be prefix-free: no key's bytes may be a proper prefix of
+// another's (fixed-width or terminated encodings are).
+template<typename Key>
+struct KeyCodec;
+
+template<>
+struct KeyCodec<int64_t> {
+    static void encode(int64_t key, std::string& out) {
+        // Flip the sign bit so negatives sort first, then store big-endian
+        uint64_t bits = static_cast<uint64_t>(key) ^ (uint64_t{1} << 63);
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<char>(bits >> shift));
+        }
+    }
+};
+
+template<>
+struct KeyCodec<uint64_t> {
+    static void encode(uint64_t key, std::string& out) {
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<char>(key >> shift));
+        }
+    }
+};
+
+template<>
+struct KeyCodec<std::string> {
+    // 0x00 bytes are escaped as 00 FF and the key ends with 00 00
+    static void encode(const std::string& key, std::string& out) {
+        for (char c : key) {
+            out.push_back(c);
+            if (c == '\0') {
+                out.push_back('\xff');
+            }
+        }
+        out.push_back('\0');
+        out.push_back('\0');
+    }
+};
+
+template<typename First, typename Second>
+struct KeyCodec<std::pair<First, Second>> {
+    static void encode(const std::pair<First, Second>& key, std::string& out) {
+        KeyCodec<First>::encode(key.first, out);
+        KeyCodec<Second>::encode(key.second, out);
+    }
+};
+
+// Approximate memory footprint of a radix tree
+struct ArtStats {
+    size_t entries = 0;
+    size_t inner_nodes = 0;
+    size_t bytes = 0;
+};
+
+// Adaptive radix tree (Leis et al., ICDE 2013) with the same interface as
+// BPlusTree. Keys are compared through their KeyCodec encoding one byte per
+// level; inner nodes hold 4, 16, 48 or 256 children and grow or shrink
+// between those sizes, and runs of single-child levels are collapsed into a
+// prefix stored in the node. Point operations cost one step per distinct
+// key byte instead of a binary search per level.
+template<typename Key, typename Value>
+class AdaptiveRadixTree {
+public:
+    AdaptiveRadixTree() = default;
+    ~AdaptiveRadixTree() { destroy(root_); }
+
+    AdaptiveRadixTree(const AdaptiveRadixTree&) = delete;
+    AdaptiveRadixTree& operator=(const AdaptiveRadixTree&) = delete;
+
+    AdaptiveRadixTree(AdaptiveRadixTree&& other) noexcept
+        : root_(std::exchange(other.root_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    AdaptiveRadixTree& operator=(AdaptiveRadixTree&& other) noexcept {
+        if (this != &other) {
+            destroy(root_);
+            root_ = std::exchange(other.root_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    // Insert a key-value pair, replacing the value if the key exists
+    void insert(const Key& key, const Value& value) {
+        art_metrics().inserts.add();
+        TOYDB_TRACE_SPAN("art.insert", "index");
+        std::string bytes;
+        KeyCodec<Key>::encode(key, bytes);
+        insert_at(root_, key, std::move(bytes), value, 0);
+    }
+
+    // Find a value by key
+    std::optional<Value> find(const Key& key) const {
+        art_metrics().finds.add();
+        TOYDB_TRACE_SPAN("art.find", "index");
+        const Leaf* leaf = find_leaf(key);
+        if (!leaf) {
+            return std::nullopt;
+        }
+        return leaf->value;
+    }
+
+    // Update a value by key
+    bool update(const Key& key, const Value& value) {
+        art_metrics().updates.add();
+        Leaf* leaf = const_cast<Leaf*>(find_leaf(key));
+        if (!leaf) {
+            return false;
+        }
+        leaf->value = value;
+        return true;
+    }
+
+    // Remove a key-value pair from the tree
+    bool remove(const Key& key) {
+        art_metrics().removes.add();
+        std::string bytes;
+        KeyCodec<Key>::encode(key, bytes);
+        if (!remove_at(root_, bytes, 0)) {
+            return false;
+        }
+        size_--;
+        return true;
+    }
+
+    // Range scan - execute function on all elements in range [start, end]
+    void range_scan(const Key& start, const Key& end,
+                    std::function<void(const Key&, const Value&)> func) const {
+        TOYDB_TRACE_SPAN("art.range_scan", "index");
+        scan_from(start, [&](const Key& key, const Value& value) {
+            if (end < key) {
+                return false;
+            }
+            func(key, value);
+            return true;
+        });
+    }
+
+    // Visit entries with keys >= start in key order until func returns false
+    void scan_from(const Key& start,
+                   const std::function<bool(const Key&, const Value&)>& func) const {
+        art_metrics().range_scans.add();
+        std::string bytes;
+        KeyCodec<Key>::encode(start, bytes);
+        if (root_) {
+            scan(root_, bytes, 0, true, func);
+        }
+    }
+
+    size_t size() const { return size_; }
+
+    ArtStats stats() const {
+        ArtStats stats;
+        collect_stats(root_, stats);
+        return stats;
+    }
+
+private:
+    enum class NodeType : uint8_t { Leaf, Node4, Node16, Node48, Node256 };
+
+    struct Node {
+        NodeType type;
+        explicit Node(NodeType t) : type(t) {}
+    };
+
+    struct Leaf : Node {
+        std::string bytes;      // Encoded key
+        Key key;
+        Value value;
+        Leaf(std::string b, const Key& k, const Value& v)
+            : Node(NodeType::Leaf), bytes(std::move(b)), key(k), value(v) {}
+    };
+
+    struct Inner : Node {
+        std::string prefix;     // Bytes shared by every key below, after the parent's edge
+        uint16_t count = 0;
+        using Node::Node;
+    };
+
+    // Node4 and Node16 keep edge bytes and children in parallel sorted arrays
+    template<size_t N, NodeType T>
+    struct SmallNode : Inner {
+        std::array<uint8_t, N> keys{};
+        std::array<Node*, N> children{};
+        SmallNode() : Inner(T) {}
+    };
+    using Node4 = SmallNode<4, NodeType::Node4>;
+    using Node16 = SmallNode<16, NodeType::Node16>;
+
+    // 256 one-byte slots indexing 48 children; 0 marks an absent edge
+    struct Node48 : Inner {
+        std::array<uint8_t, 256> index{};
+        std::array<Node*, 48> children{};
+        Node48() : Inner(NodeType::Node48) {}
+    };
+
+    struct Node256 : Inner {
+        std::array<Node*, 256> children{};
+        Node256() : Inner(NodeType::Node256) {}
+    };
+
+    Node* root_ = nullptr;
+    size_t size_ = 0;
+
+    static bool is_leaf(const Node* node) { return node->type == NodeType::Leaf; }
+
+    const Leaf* find_leaf(const Key& key) const {
+        thread_local std::string bytes;
+        bytes.clear();
+        KeyCodec<Key>::encode(key, bytes);
+
+        const Node* node = root_;
+        size_t depth = 0;
+        while (node) {
+            if (is_leaf(node)) {
+                const auto* leaf = static_cast<const Leaf*>(node);
+                return leaf->bytes == bytes ? leaf : nullptr;
+            }
+            const auto* inner = static_cast<const Inner*>(node);
+            if (bytes.compare(depth, inner->prefix.size(), inner->prefix) != 0) {
+                return nullptr;
+            }
+            depth += inner->prefix.size();
+            if (depth >= bytes.size()) {
+                return nullptr;
+            }
+            Node* const* child = find_child(const_cast<Inner*>(inner),
+                                            static_cast<uint8_t>(bytes[depth]));
+            node = child ? *child : nullptr;
+            depth++;
+        }
+        return nullptr;
+    }
+
+    // Slot holding the child for an edge byte, or nullptr
+    static Node** find_child(Inner* node, uint8_t byte) {
+        switch (node->type) {
+            case NodeType::Node4: {
+                auto* n = static_cast<Node4*>(node);
+                for (size_t i = 0; i < n->count; ++i) {
+                    if (n->keys[i] == byte) return &n->children[i];
+                }
+                return nullptr;
+            }
+            case NodeType::Node16: {
+                auto* n = static_cast<Node16*>(node);
+#if defined(__SSE2__)
+                __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys.data()));
+                __m128i cmp = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(cmp)) &
+                                ((1u << n->count) - 1);
+                return mask ? &n->children[__builtin_ctz(mask)] : nullptr;
+#else
+                for (size_t i = 0; i < n->count; ++i) {
+                    if (n->keys[i] == byte) return &n->children[i];
+                }
+                return nullptr;
+#endif
+            }
+            case NodeType::Node48: {
+                auto* n = static_cast<Node48*>(node);
+                uint8_t slot = n->index[byte];
+                return slot ? &n->children[slot - 1] : nullptr;
+            }
+            case NodeType::Node256: {
+                auto* n = static_cast<Node256*>(node);
+                return n->children[byte] ? &n->children[byte] : nullptr;
+            }
+            default:
+                return nullptr;
+        }
+    }
+
+    // Add an edge to a node that does not have it, growing the node (and
+    // replacing it in its parent's slot) when full
+    static void add_child(Node*& slot, uint8_t byte, Node* child) {
+        auto* node = static_cast<Inner*>(slot);
+        switch (node->type) {
+            case NodeType::Node4:
+                if (node->count < 4) {
+                    insert_sorted(*static_cast<Node4*>(node), byte, child);
+                    return;
+                }
+                slot = grow_small<Node4, Node16>(static_cast<Node4*>(node));
+                break;
+            case NodeType::Node16:
+                if (node->count < 16) {
+                    insert_sorted(*static_cast<Node16*>(node), byte, child);
+                    return;
+                }
+                slot = grow16(static_cast<Node16*>(node));
+                break;
+            case NodeType::Node48: {
+                auto* n = static_cast<Node48*>(node);
+                if (n->count < 48) {
+                    size_t free = 0;
+                    while (n->children[free]) free++;
+                    n->children[free] = child;
+                    n->index[byte] = static_cast<uint8_t>(free + 1);
+                    n->count++;
+                    return;
+                }
+                slot = grow48(n);
+                break;
+            }
+            case NodeType::Node256: {
+                auto* n = static_cast<Node256*>(node);
+                n->children[byte] = child;
+                n->count++;
+                return;
+            }
+            default:
+                return;
+        }
+        art_metrics().node_grows.add();
+        add_child(slot, byte, child);
+    }
+
+    template<typename Small>
+    static void insert_sorted(Small& n, uint8_t byte, Node* child) {
+        size_t i = 0;
+        while (i < n.count && n.keys[i] < byte) i++;
+        for (size_t j = n.count; j > i; --j) {
+            n.keys[j] = n.keys[j - 1];
+            n.children[j] = n.children[j - 1];
+        }
+        n.keys[i] = byte;
+        n.children[i] = child;
+        n.count++;
+    }
+
+    template<typename From, typename To>
+    static Node* grow_small(From* old) {
+        auto* n = new To();
+        n->prefix = std::move(old->prefix);
+        n->count = old->count;
+        for (size_t i = 0; i < old->count; ++i) {
+            n->keys[i] = old->keys[i];
+            n->children[i] = old->children[i];
+        }
+        delete old;
+        return n;
+    }
+
+    static Node* grow16(Node16* old) {
+        auto* n = new Node48();
+        n->prefix = std::move(old->prefix);
+        n->count = old->count;
+        for (size_t i = 0; i < old->count; ++i) {
+            n->children[i] = old->children[i];
+            n->index[old->keys[i]] = static_cast<uint8_t>(i + 1);
+        }
+        delete old;
+        return n;
+    }
+
+    static Node* grow48(Node48* old) {
+        auto* n = new Node256();
+        n->prefix = std::move(old->prefix);
+        n->count = old->count;
+        for (size_t b = 0; b < 256; ++b) {
+            if (old->index[b]) {
+                n->children[b] = old->children[old->index[b] - 1];
+            }
+        }
+        delete old;
+        return n;
+    }
+
+    // Drop the edge behind a child slot and shrink the node when it gets
+    // sparse; a node left with one child is merged into that child
+    static void remove_child(Node*& slot, uint8_t byte) {
+        auto* node = static_cast<Inner*>(slot);
+        switch (node->type) {
+            case NodeType::Node4:
+            case NodeType::Node16: {
+                if (node->type == NodeType::Node4) {
+                    erase_sorted(*static_cast<Node4*>(node), byte);
+                } else {
+                    erase_sorted(*static_cast<Node16*>(node), byte);
+                    if (node->count <= 3) {
+                        slot = shrink16(static_cast<Node16*>(node));
+                    }
+                }
+                break;
+            }
+            case NodeType::Node48: {
+                auto* n = static_cast<Node48*>(node);
+                n->children[n->index[byte] - 1] = nullptr;
+                n->index[byte] = 0;
+                n->count--;
+                if (n->count <= 12) {
+                    slot = shrink48(n);
+                }
+                break;
+            }
+            case NodeType::Node256: {
+                auto* n = static_cast<Node256*>(node);
+                n->children[byte] = nullptr;
+                n->count--;
+                if (n->count <= 40) {
+                    slot = shrink256(n);
+                }
+                break;
+            }
+            default:
+                return;
+        }
+
+        if (slot->type == NodeType::Node4 && static_cast<Inner*>(slot)->count == 1) {
+            auto* n = static_cast<Node4*>(slot);
+            Node* child = n->children[0];
+            if (!is_leaf(child)) {
+                auto* inner = static_cast<Inner*>(child);
+                inner->prefix = n->prefix + static_cast<char>(n->keys[0]) + inner->prefix;
+            }
+            delete n;
+            slot = child;
+        }
+    }
+
+    template<typename Small>
+    static void erase_sorted(Small& n, uint8_t byte) {
+        size_t i = 0;
+        while (n.keys[i] != byte) i++;
+        for (; i + 1 < n.count; ++i) {
+            n.keys[i] = n.keys[i + 1];
+            n.children[i] = n.children[i + 1];
+        }
+        n.count--;
+    }
+
+    static Node* shrink16(Node16* old) {
+        auto* n = new Node4();
+        n->prefix = std::move(old->prefix);
+        n->count = old->count;
+        for (size_t i = 0; i < old->count; ++i) {
+            n->keys[i] = old->keys[i];
+            n->children[i] = old->children[i];
+        }
+        delete old;
+        return n;
+    }
+
+    static Node* shrink48(Node48* old) {
+        auto* n = new Node16();
+        n->prefix = std::move(old->prefix);
+        for (size_t b = 0; b < 256; ++b) {
+            if (old->index[b]) {
+                n->keys[n->count] = static_cast<uint8_t>(b);
+                n->children[n->count] = old->children[old->index[b] - 1];
+                n->count++;
+            }
+        }
+        delete old;
+        return n;
+    }
+
+    static Node* shrink256(Node256* old) {
+        auto* n = new Node48();
+        n->prefix = std::move(old->prefix);
+        for (size_t b = 0; b < 256; ++b) {
+            if (old->children[b]) {
+                n->children[n->count] = old->children[b];
+                n->index[b] = static_cast<uint8_t>(n->count + 1);
+                n->count++;
+            }
+        }
+        delete old;
+        return n;
+    }
+
+    static size_t common_prefix(std::string_view a, std::string_view b) {
+        size_t n = std::min(a.size(), b.size());
+        size_t i = 0;
+        while (i < n && a[i] == b[i]) i++;
+        return i;
+    }
+
+    void insert_at(Node*& slot, const Key& key, std::string bytes, const Value& value,
+                   size_t depth) {
+        if (!slot) {
+            slot = new Leaf(std::move(bytes), key, value);
+            size_++;
+            return;
+        }
+
+        if (is_leaf(slot)) {
+            auto* leaf = static_cast<Leaf*>(slot);
+            if (leaf->bytes == bytes) {
+                leaf->value = value;
+                return;
+            }
+            // Split the leaf: both keys continue past their common bytes
+            // because encodings are prefix-free
+            std::string_view existing(leaf->bytes);
+            size_t shared = common_prefix(existing.substr(depth),
+                                          std::string_view(bytes).substr(depth));
+            auto* node = new Node4();
+            node->prefix.assign(bytes, depth, shared);
+            size_t split = depth + shared;
+            uint8_t new_byte = static_cast<uint8_t>(bytes[split]);
+            insert_sorted(*node, static_cast<uint8_t>(existing[split]), leaf);
+            insert_sorted(*node, new_byte, new Leaf(std::move(bytes), key, value));
+            slot = node;
+            size_++;
+            return;
+        }
+
+        auto* inner = static_cast<Inner*>(slot);
+        size_t shared = common_prefix(inner->prefix, std::string_view(bytes).substr(depth));
+        if (shared < inner->prefix.size()) {
+            // The key leaves the compressed path: split it at the mismatch
+            auto* node = new Node4();
+            node->prefix = inner->prefix.substr(0, shared);
+            uint8_t old_byte = static_cast<uint8_t>(inner->prefix[shared]);
+            inner->prefix.erase(0, shared + 1);
+            uint8_t new_byte = static_cast<uint8_t>(bytes[depth + shared]);
+            insert_sorted(*node, old_byte, inner);
+            insert_sorted(*node, new_byte, new Leaf(std::move(bytes), key, value));
+            slot = node;
+            size_++;
+            return;
+        }
+
+        depth += inner->prefix.size();
+        uint8_t byte = static_cast<uint8_t>(bytes[depth]);
+        if (Node** child = find_child(inner, byte)) {
+            insert_at(*child, key, std::move(bytes), value, depth + 1);
+            return;
+        }
+        add_child(slot, byte, new Leaf(std::move(bytes), key, value));
+        size_++;
+    }
+
+    static bool remove_at(Node*& slot, const std::string& bytes, size_t depth) {
+        if (!slot) {
+            return false;
+        }
+        if (is_leaf(slot)) {
+            // Only reached for a root leaf; deeper leaves are removed by
+            // their parent below
+            if (static_cast<Leaf*>(slot)->bytes != bytes) {
+                return false;
+            }
+            delete static_cast<Leaf*>(slot);
+            slot = nullptr;
+            return true;
+        }
+
+        auto* inner = static_cast<Inner*>(slot);
+        if (bytes.compare(depth, inner->prefix.size(), inner->prefix) != 0) {
+            return false;
+        }
+        depth += inner->prefix.size();
+        if (depth >= bytes.size()) {
+            return false;
+        }
+        uint8_t byte = static_cast<uint8_t>(bytes[depth]);
+        Node** child = find_child(inner, byte);
+        if (!child) {
+            return false;
+        }
+        if (is_leaf(*child)) {
+            if (static_cast<Leaf*>(*child)->bytes != bytes) {
+                return false;
+            }
+            delete static_cast<Leaf*>(*child);
+            remove_child(slot, byte);
+            return true;
+        }
+        return remove_at(*child, bytes, depth + 1);
+    }
+
+    // In-order walk from the first key >= start. While bounded, the path so
+    // far equals start's bytes and smaller subtrees are skipped.
+    template<typename F>
+    static bool scan(const Node* node, const std::string& start, size_t depth, bool bounded,
+                     const F& func) {
+        if (is_leaf(node)) {
+            const auto* leaf = static_cast<const Leaf*>(node);
+            if (bounded && leaf->bytes < start) {
+                return true;
+            }
+            return func(leaf->key, leaf->value);
+        }
+
+        const auto* inner = static_cast<const Inner*>(node);
+        int edge = -1;
+        if (bounded) {
+            std::string_view rest = std::string_view(start).substr(std::min(depth, start.size()));
+            int cmp = rest.substr(0, inner->prefix.size()).compare(inner->prefix);
+            if (cmp > 0) {
+                return true;            // Whole subtree sorts before start
+            }
+            depth += inner->prefix.size();
+            if (cmp < 0 || depth >= start.size()) {
+                bounded = false;        // Whole subtree sorts after start
+            } else {
+                edge = static_cast<uint8_t>(start[depth]);
+            }
+        }
+
+        auto visit = [&](int byte, const Node* child) {
+            if (byte < edge) {
+                return true;
+            }
+            return scan(child, start, depth + 1, bounded && byte == edge, func);
+        };
+
+        switch (inner->type) {
+            case NodeType::Node4:
+            case NodeType::Node16: {
+                const uint8_t* keys;
+                Node* const* children;
+                if (inner->type == NodeType::Node4) {
+                    keys = static_cast<const Node4*>(inner)->keys.data();
+                    children = static_cast<const Node4*>(inner)->children.data();
+                } else {
+                    keys = static_cast<const Node16*>(inner)->keys.data();
+                    children = static_cast<const Node16*>(inner)->children.data();
+                }
+                for (size_t i = 0; i < inner->count; ++i) {
+                    if (!visit(keys[i], children[i])) return false;
+                }
+                return true;
+            }
+            case NodeType::Node48: {
+                const auto* n = static_cast<const Node48*>(inner);
+                for (int b = std::max(edge, 0); b < 256; ++b) {
+                    if (n->index[b] && !visit(b, n->children[n->index[b] - 1])) return false;
+                }
+                return true;
+            }
+            case NodeType::Node256: {
+                const auto* n = static_cast<const Node256*>(inner);
+                for (int b = std::max(edge, 0); b < 256; ++b) {
+                    if (n->children[b] && !visit(b, n->children[b])) return false;
+                }
+                return true;
+            }
+            default:
+                return true;
+        }
+    }
+
+    static void destroy(Node* node) {
+        if (!node) return;
+        for_each_child(node, [](Node* child) { destroy(child); });
+        switch (node->type) {
+            case NodeType::Leaf: delete static_cast<Leaf*>(node); break;
+            case NodeType::Node4: delete static_cast<Node4*>(node); break;
+            case NodeType::Node16: delete static_cast<Node16*>(node); break;
+            case NodeType::Node48: delete static_cast<Node48*>(node); break;
+            case NodeType::Node256: delete static_cast<Node256*>(node); break;
+        }
+    }
+
+    template<typename F>
+    static void for_each_child(const Node* node, F&& f) {
+        switch (node->type) {
+            case NodeType::Node4: {
+                const auto* n = static_cast<const Node4*>(node);
+                for (size_t i = 0; i < n->count; ++i) f(n->children[i]);
+                break;
+            }
+            case NodeType::Node16: {
+                const auto* n = static_cast<const Node16*>(node);
+                for (size_t i = 0; i < n->count; ++i) f(n->children[i]);
+                break;
+            }
+            case NodeType::Node48: {
+                const auto* n = static_cast<const Node48*>(node);
+                for (Node* child : n->children) if (child) f(child);
+                break;
+            }
+            case NodeType::Node256: {
+                const auto* n = static_cast<const Node256*>(node);
+                for (Node* child : n->children) if (child) f(child);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    static void collect_stats(const Node* node, ArtStats& stats) {
+        if (!node) return;
+        switch (node->type) {
+            case NodeType::Leaf: {
+                const auto* leaf = static_cast<const Leaf*>(node);
+                stats.entries++;
+                stats.bytes += sizeof(Leaf) + heap_bytes(leaf->bytes) +
+                               heap_bytes(leaf->key) + heap_bytes(leaf->value);
+                return;
+            }
+            case NodeType::Node4: stats.bytes += sizeof(Node4); break;
+            case NodeType::Node16: stats.bytes += sizeof(Node16); break;
+            case NodeType::Node48: stats.bytes += sizeof(Node48); break;
+            case NodeType::Node256: stats.bytes += sizeof(Node256); break;
+        }
+        stats.inner_nodes++;
+        stats.bytes += heap_bytes(static_cast<const Inner*>(node)->prefix);
+        for_each_child(node, [&stats](const Node* child) { collect_stats(child, stats); });
+    }
+};
+
+} // namespace storage
+} // namespace toydb
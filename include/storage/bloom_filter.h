@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace toydb {
+namespace storage {
+
+// Blocked Bloom filter: every key sets all of its bits inside one 64-byte
+// block, so a probe costs a single cache miss. It only ever answers "maybe"
+// or "definitely not"; keys cannot be removed, so owners rebuild it when
+// deletes or growth have made it stale.
+class BloomFilter {
+public:
+    static constexpr size_t kBitsPerKey = 10;
+    static constexpr unsigned kProbes = 6;     // ~1% false positives at 10 bits/key
+
+    explicit BloomFilter(size_t expected_keys = 1024) { reset(expected_keys); }
+
+    // Empty the filter and size it for expected_keys
+    void reset(size_t expected_keys) {
+        capacity_ = expected_keys < 64 ? 64 : expected_keys;
+        size_t blocks = (capacity_ * kBitsPerKey + kBlockBits - 1) / kBlockBits;
+        blocks_.assign(blocks, Block{});
+        count_ = 0;
+    }
+
+    void add(uint64_t hash) {
+        Block& block = blocks_[block_of(hash)];
+        uint64_t h2 = (hash >> 32) | (hash << 32);
+        for (unsigned i = 0; i < kProbes; ++i) {
+            unsigned bit = static_cast<unsigned>((hash + i * h2) & (kBlockBits - 1));
+            block.words[bit / 64] |= uint64_t{1} << (bit % 64);
+        }
+        count_++;
+    }
+
+    bool may_contain(uint64_t hash) const {
+        const Block& block = blocks_[block_of(hash)];
+        uint64_t h2 = (hash >> 32) | (hash << 32);
+        for (unsigned i = 0; i < kProbes; ++i) {
+            unsigned bit = static_cast<unsigned>((hash + i * h2) & (kBlockBits - 1));
+            if (!(block.words[bit / 64] & (uint64_t{1} << (bit % 64)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t count() const { return count_; }
+
+    // More keys than it was sized for; the false positive rate climbs
+    bool overloaded() const { return count_ > capacity_; }
+
+    size_t memory_bytes() const { return blocks_.capacity() * sizeof(Block); }
+
+private:
+    static constexpr size_t kBlockBits = 512;
+
+    struct alignas(64) Block {
+        uint64_t words[kBlockBits / 64] = {};
+    };
+
+    std::vector<Block> blocks_;
+    size_t capacity_ = 0;
+    size_t count_ = 0;
+
+    // Map the high 32 bits onto [0, blocks) without a division
+    size_t block_of(uint64_t hash) const {
+        return static_cast<size_t>(((hash >> 32) * blocks_.size()) >> 32);
+    }
+};
+
+// 64-bit hashes for filter keys
+inline uint64_t hash_key(int64_t key) {
+    uint64_t h = static_cast<uint64_t>(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+inline uint64_t hash_key(const std::string& key) {
+    // FNV-1a, finished with the integer mixer
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (unsigned char c : key) {
+        h = (h ^ c) * 0x100000001b3ULL;
+    }
+    return hash_key(static_cast<int64_t>(h));
+}
+
+} // namespace storage
+} // namespace toydb
@@ -6,10 +6,57 @@
 #include <functional>
 #include <algorithm>
 #include <stdexcept>
+#include <string>
+#include "../metrics/metrics.h"
+#include "../metrics/trace.h"
 
 namespace toydb {
 namespace storage {
 
+// Operation counters shared by every tree instance
+struct BPlusTreeMetrics {
+    metrics::Counter& inserts;
+    metrics::Counter& finds;
+    metrics::Counter& updates;
+    metrics::Counter& removes;
+    metrics::Counter& range_scans;
+    metrics::Counter& splits;
+};
+
+inline BPlusTreeMetrics& bplustree_metrics() {
+    static BPlusTreeMetrics m{
+        metrics::counter("bptree.insert"),
+        metrics::counter("bptree.find"),
+        metrics::counter("bptree.update"),
+        metrics::counter("bptree.remove"),
+        metrics::counter("bptree.range_scan"),
+        metrics::counter("bptree.node_splits"),
+    };
+    return m;
+}
+
+// Heap bytes owned by a key or value beyond its sizeof; strings count their
+// buffer once it no longer fits in the small-string storage
+template<typename T>
+size_t heap_bytes(const T&) {
+    return 0;
+}
+
+inline size_t heap_bytes(const std::string& s) {
+    static const size_t sso_capacity = std::string().capacity();
+    return s.capacity() > sso_capacity ? s.capacity() + 1 : 0;
+}
+
+// Shape and approximate memory footprint of a tree
+struct BPlusTreeStats {
+    size_t entries = 0;
+    size_t leaf_nodes = 0;
+    size_t internal_nodes = 0;
+    size_t height = 0;
+    size_t bytes = 0;
+    double fill_factor = 0.0;  // Average leaf occupancy relative to Order
+};
+
 template<typename Key, typename Value, size_t Order = 4>
 class BPlusTree {
 public:
@@ -17,6 +64,8 @@ public:
 
     // Insert a key-value pair into the tree
     void insert(const Key& key, const Value& value) {
+        bplustree_metrics().inserts.add();
+        TOYDB_TRACE_SPAN("bptree.insert", "index");
         auto result = root_->insert(key, value);
         if (result.has_value()) {
             // Need to create a new root
@@ -30,16 +79,77 @@ public:
 
     // Find a value by key
     std::optional<Value> find(const Key& key) const {
+        bplustree_metrics().finds.add();
+        TOYDB_TRACE_SPAN("bptree.find", "index");
         return root_->find(key);
     }
 
+    // Find many keys at once; result i is the value for keys[i]. Probes run
+    // in key order, kFindLanes descents in lockstep: each level's nodes are
+    // prefetched for every lane before any lane reads them, so the cache
+    // misses of different keys overlap instead of queueing one descent
+    // behind another.
+    std::vector<std::optional<Value>> find_many(const std::vector<Key>& keys) const {
+        bplustree_metrics().finds.add(keys.size());
+        TOYDB_TRACE_SPAN("bptree.find_many", "index");
+
+        std::vector<size_t> order(keys.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(),
+                  [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+        std::vector<std::optional<Value>> results(keys.size());
+        const Node* nodes[kFindLanes];
+        for (size_t begin = 0; begin < order.size(); begin += kFindLanes) {
+            size_t lanes = std::min(kFindLanes, order.size() - begin);
+            for (size_t l = 0; l < lanes; ++l) {
+                nodes[l] = root_.get();
+            }
+
+            // Every leaf is at the same depth, so the lanes reach the
+            // leaves together
+            while (nodes[0]->is_internal()) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    const auto* internal = static_cast<const InternalNode*>(nodes[l]);
+                    __builtin_prefetch(internal->keys.data());
+                    __builtin_prefetch(internal->children.data());
+                }
+                for (size_t l = 0; l < lanes; ++l) {
+                    const auto* internal = static_cast<const InternalNode*>(nodes[l]);
+                    const Key& key = keys[order[begin + l]];
+                    nodes[l] = internal->children[internal->find_child_index(key)].get();
+                    __builtin_prefetch(nodes[l]);
+                }
+            }
+
+            for (size_t l = 0; l < lanes; ++l) {
+                const auto* leaf = static_cast<const LeafNode*>(nodes[l]);
+                __builtin_prefetch(leaf->keys.data());
+                __builtin_prefetch(leaf->values.data());
+            }
+            for (size_t l = 0; l < lanes; ++l) {
+                const auto* leaf = static_cast<const LeafNode*>(nodes[l]);
+                size_t slot = order[begin + l];
+                auto it = std::lower_bound(leaf->keys.begin(), leaf->keys.end(), keys[slot]);
+                if (it != leaf->keys.end() && *it == keys[slot]) {
+                    results[slot] = leaf->values[it - leaf->keys.begin()];
+                }
+            }
+        }
+        return results;
+    }
+
     // Update a value by key
     bool update(const Key& key, const Value& value) {
+        bplustree_metrics().updates.add();
         return root_->update(key, value);
     }
 
     // Remove a key-value pair from the tree
     bool remove(const Key& key) {
+        bplustree_metrics().removes.add();
         auto result = root_->remove(key);
         if (result && root_->is_internal() && 
             static_cast<InternalNode*>(root_.get())->keys.empty()) {
@@ -52,9 +162,50 @@ public:
     // Range scan - execute function on all elements in range [start, end]
     void range_scan(const Key& start, const Key& end, 
                    std::function<void(const Key&, const Value&)> func) const {
+        bplustree_metrics().range_scans.add();
+        TOYDB_TRACE_SPAN("bptree.range_scan", "index");
         root_->range_scan(start, end, func);
     }
 
+    // Visit entries with keys >= start in key order until func returns false
+    void scan_from(const Key& start,
+                   const std::function<bool(const Key&, const Value&)>& func) const {
+        bplustree_metrics().range_scans.add();
+        TOYDB_TRACE_SPAN("bptree.scan_from", "index");
+
+        const Node* node = root_.get();
+        while (node->is_internal()) {
+            const auto* internal = static_cast<const InternalNode*>(node);
+            node = internal->children[internal->find_child_index(start)].get();
+        }
+
+        const auto* leaf = static_cast<const LeafNode*>(node);
+        auto it = std::lower_bound(leaf->keys.begin(), leaf->keys.end(), start);
+        size_t i = it - leaf->keys.begin();
+        while (leaf) {
+            for (; i < leaf->keys.size(); ++i) {
+                if (!func(leaf->keys[i], leaf->values[i])) {
+                    return;
+                }
+            }
+            leaf = leaf->next.get();
+            i = 0;
+        }
+    }
+
+    // Walk the whole tree; node bytes include the shared_ptr control block
+    // that make_shared allocates alongside each node
+    BPlusTreeStats stats() const {
+        BPlusTreeStats stats;
+        collect_stats(*root_, 1, stats);
+
+        size_t leaf_capacity = stats.leaf_nodes * Order;
+        if (leaf_capacity > 0) {
+            stats.fill_factor = static_cast<double>(stats.entries) / leaf_capacity;
+        }
+        return stats;
+    }
+
 private:
     // Forward declarations
     class Node;
@@ -105,6 +256,7 @@ private:
 
             // Check if we need to split the node
             if (keys.size() > Order) {
+                bplustree_metrics().splits.add();
                 auto new_leaf = std::make_shared<LeafNode>();
                 int mid = keys.size() / 2;
                 
@@ -166,8 +318,8 @@ private:
                 ++it;
             }
             
-            // Continue to next leaf if needed
-            if (next && end >= next->keys.front()) {
+            // Continue to next leaf if needed (leaves can be empty after removes)
+            if (next && (next->keys.empty() || end >= next->keys.front())) {
                 next->range_scan(start, end, func);
             }
         }
@@ -201,6 +353,7 @@ private:
             
             // Check if we need to split the node
             if (keys.size() > Order) {
+                bplustree_metrics().splits.add();
                 auto new_internal = std::make_shared<InternalNode>();
                 int mid = keys.size() / 2;
                 
@@ -247,6 +400,44 @@ private:
     };
 
     std::shared_ptr<Node> root_;
+
+    // Descents find_many interleaves; enough to cover memory latency while
+    // the lanes' nodes still fit in L1
+    static constexpr size_t kFindLanes = 16;
+
+    // Approximate size of a shared_ptr control block
+    static constexpr size_t kControlBlockBytes = 2 * sizeof(long) + sizeof(void*);
+
+    template<typename T>
+    static size_t vector_bytes(const std::vector<T>& v) {
+        size_t bytes = v.capacity() * sizeof(T);
+        for (const auto& item : v) {
+            bytes += heap_bytes(item);
+        }
+        return bytes;
+    }
+
+    static void collect_stats(const Node& node, size_t depth, BPlusTreeStats& stats) {
+        stats.height = std::max(stats.height, depth);
+
+        if (node.is_leaf()) {
+            const auto& leaf = static_cast<const LeafNode&>(node);
+            stats.leaf_nodes++;
+            stats.entries += leaf.keys.size();
+            stats.bytes += sizeof(LeafNode) + kControlBlockBytes +
+                           vector_bytes(leaf.keys) + vector_bytes(leaf.values);
+            return;
+        }
+
+        const auto& internal = static_cast<const InternalNode&>(node);
+        stats.internal_nodes++;
+        stats.bytes += sizeof(InternalNode) + kControlBlockBytes +
+                       vector_bytes(internal.keys) +
+                       internal.children.capacity() * sizeof(std::shared_ptr<Node>);
+        for (const auto& child : internal.children) {
+            collect_stats(*child, depth + 1, stats);
+        }
+    }
 };
 
 } // namespace storage
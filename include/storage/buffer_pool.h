@@ -0,0 +1,181 @@
+#pragma once
+
+#include <string>
+#include <list>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include "io_backend.h"
+
+namespace toydb {
+namespace storage {
+
+using PageId = uint64_t;
+
+constexpr size_t kPageSize = 4096;
+
+struct BufferPoolOptions {
+    size_t memory_budget = 64 * 1024 * 1024; // Bytes of page frames
+    double a1in_fraction = 0.25;  // Share of frames for pages seen only once
+    double a1out_fraction = 0.5;  // Ghost entries remembered, relative to frames
+    size_t readahead_min_pages = 4;   // Initial read-ahead window
+    size_t readahead_max_pages = 64;  // The window doubles up to this size
+    IOBackendKind io_backend = IOBackendKind::Auto;
+};
+
+struct BufferPoolStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t writebacks = 0;  // Dirty pages written to disk
+    uint64_t readahead_pages = 0; // Pages read ahead asynchronously
+    uint64_t readahead_hits = 0;  // Read-ahead pages that were later fetched
+};
+
+class BufferPool;
+
+// Pinned page; unpins on destruction
+class PageHandle {
+public:
+    PageHandle() = default;
+    PageHandle(BufferPool* pool, PageId id, char* data) : pool_(pool), id_(id), data_(data) {}
+    ~PageHandle() { release(); }
+
+    PageHandle(PageHandle&& other) noexcept { *this = std::move(other); }
+    PageHandle& operator=(PageHandle&& other) noexcept;
+    PageHandle(const PageHandle&) = delete;
+    PageHandle& operator=(const PageHandle&) = delete;
+
+    explicit operator bool() const { return data_ != nullptr; }
+    PageId id() const { return id_; }
+    char* data() const { return data_; }
+    void mark_dirty() { dirty_ = true; }
+
+    // Unpin now instead of at destruction
+    void release();
+
+private:
+    BufferPool* pool_ = nullptr;
+    PageId id_ = 0;
+    char* data_ = nullptr;
+    bool dirty_ = false;
+};
+
+// Caches fixed-size pages of one file in a bounded set of frames.
+//
+// Replacement uses 2Q: a page enters the A1in FIFO on its first access and
+// is only promoted to the LRU-managed Am queue if it is accessed again after
+// being evicted from A1in (tracked by the A1out ghost queue). A large scan
+// therefore cycles through A1in and cannot flush the hot pages in Am.
+//
+// Sequential fetches trigger asynchronous read-ahead of the following pages.
+// The window starts small, doubles while the access pattern stays
+// sequential and resets on the first random access.
+class BufferPool {
+public:
+    BufferPool(const std::string& path, BufferPoolOptions options = {});
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    // Pin an existing page, reading it from disk if needed.
+    // Returns an empty handle if every frame is pinned.
+    PageHandle fetch_page(PageId id);
+
+    // Allocate a zeroed page at the end of the file and pin it
+    PageHandle new_page();
+
+    // Start asynchronous reads of up to count pages starting at first, for
+    // callers that know their access pattern ahead of time
+    void prefetch(PageId first, size_t count);
+
+    // Drop one pin; dirty pages are written back when evicted or flushed
+    void unpin_page(PageId id, bool dirty);
+
+    // Write a page (if dirty) or every dirty page to disk
+    bool flush_page(PageId id);
+    void flush_all();
+
+    BufferPoolStats stats() const;
+    size_t capacity() const { return num_frames_; }
+    PageId page_count() const;
+
+private:
+    enum class Queue { None, A1in, Am };
+
+    struct Frame {
+        PageId page_id = 0;
+        int pin_count = 0;
+        bool dirty = false;
+        bool io_pending = false;  // Read-ahead still in flight
+        bool prefetched = false;  // Loaded by read-ahead, not fetched yet
+        Queue queue = Queue::None;
+        std::list<size_t>::iterator position; // Position in its queue
+    };
+
+    BufferPoolOptions options_;
+    int fd_ = -1;
+    std::unique_ptr<IOBackend> io_;
+    bool buffers_registered_ = false;
+
+    size_t num_frames_;
+    size_t a1in_capacity_;
+    size_t a1out_capacity_;
+    char* memory_ = nullptr;            // num_frames_ * kPageSize, page aligned
+    std::vector<Frame> frames_;
+    std::vector<size_t> free_frames_;
+
+    std::unordered_map<PageId, size_t> page_table_; // Resident page -> frame
+    std::list<size_t> a1in_;   // FIFO of frames, newest at front
+    std::list<size_t> am_;     // LRU of frames, most recent at front
+    std::list<PageId> a1out_;  // FIFO of evicted page ids, newest at front
+    std::unordered_map<PageId, std::list<PageId>::iterator> a1out_index_;
+
+    PageId num_pages_ = 0;
+    BufferPoolStats stats_;
+
+    // Outstanding I/O; ids are handed to the backend as user_data
+    uint64_t next_io_id_ = 1;
+    std::unordered_map<uint64_t, size_t> readahead_ios_;  // Id -> frame
+    std::unordered_map<uint64_t, int64_t> finished_ios_;  // Id -> result
+
+    // Sequential access detection
+    PageId last_page_ = 0;
+    size_t sequential_run_ = 0;
+    size_t readahead_window_;
+    PageId readahead_next_ = 0;  // First page not yet covered by read-ahead
+
+    mutable std::mutex mutex_;
+
+    char* frame_data(size_t frame) const { return memory_ + frame * kPageSize; }
+
+    // Find a frame for a new page, evicting if necessary; -1 if all pinned
+    long acquire_frame();
+    // For read-ahead: a free frame or a clean, idle one from an over-full
+    // A1in; never evicts Am, writes back or waits; -1 if there is none
+    long acquire_readahead_frame();
+    bool evict_from(std::list<size_t>& queue, bool remember, bool clean_only = false);
+    void remove_from_queue(Frame& frame);
+    void remember_evicted(PageId id);
+
+    // Track the access pattern and issue read-ahead when it is sequential
+    void note_access(PageId id);
+    void start_readahead(PageId first, size_t count);
+
+    uint64_t issue_io(IOOp op, size_t frame, PageId id);
+    int64_t wait_io(uint64_t io_id);
+    void wait_for_frame(size_t frame);
+    // Handle finished I/O; blocks for at least one completion if wait is set
+    void poll_completions(bool wait);
+    void handle_completion(const IOCompletion& completion);
+
+    bool read_page(size_t frame, PageId id);
+    bool write_page(size_t frame);
+};
+
+} // namespace storage
+} // namespace toydb
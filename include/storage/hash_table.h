@@ -0,0 +1,293 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace toydb {
+namespace storage {
+
+// Open-addressing hash multimap in the style of Swiss tables. Each slot has
+// a one-byte control tag holding 7 bits of its hash, so a probe compares a
+// whole group of 16 tags at once (SSE2 when available) and only touches
+// entries whose tag matches. Duplicate keys are allowed; each (key, value)
+// pair occupies its own slot.
+//
+// Growing never rehashes everything at once: the old slot array is kept
+// and a few groups are moved to the new one on every insert or erase, while
+// lookups consult both until the move is complete.
+template<typename Key, typename Value, typename Hash = std::hash<Key>,
+         typename KeyEqual = std::equal_to<Key>>
+class HashTable {
+public:
+    static constexpr size_t kGroupWidth = 16;
+
+    HashTable() = default;
+
+    void insert(const Key& key, const Value& value) {
+        migrate_some();
+        if (needs_growth()) {
+            start_growth();
+        }
+        insert_into(current_, hash_of(key), key, value);
+        size_++;
+    }
+
+    // Call f(value) for every entry whose key equals key
+    template<typename F>
+    void for_each(const Key& key, F&& f) const {
+        uint64_t hash = hash_of(key);
+        find_in(current_, hash, key, f);
+        if (!old_.empty()) {
+            find_in(old_, hash, key, f);
+        }
+    }
+
+    bool contains(const Key& key) const {
+        bool found = false;
+        for_each(key, [&found](const Value&) { found = true; });
+        return found;
+    }
+
+    // Remove one entry matching both key and value
+    bool erase(const Key& key, const Value& value) {
+        migrate_some();
+        uint64_t hash = hash_of(key);
+        if (erase_from(current_, hash, key, value) ||
+            (!old_.empty() && erase_from(old_, hash, key, value))) {
+            size_--;
+            return true;
+        }
+        return false;
+    }
+
+    void clear() {
+        current_ = Slots();
+        old_ = Slots();
+        migrated_groups_ = 0;
+        size_ = 0;
+    }
+
+    size_t size() const { return size_; }
+    bool migrating() const { return !old_.empty(); }
+
+    // Bytes of the slot arrays, excluding heap memory owned by keys
+    size_t memory_bytes() const {
+        return current_.memory_bytes() + old_.memory_bytes();
+    }
+
+    // Visit every entry (in no particular order)
+    template<typename F>
+    void for_each_entry(F&& f) const {
+        current_.for_each_entry(f);
+        old_.for_each_entry(f);
+    }
+
+private:
+    static constexpr int8_t kEmpty = -128;    // 0b10000000
+    static constexpr int8_t kDeleted = -2;    // 0b11111110
+    static constexpr size_t kMinGroups = 1;
+    static constexpr size_t kMigrateGroupsPerOp = 2;
+
+    struct Entry {
+        Key key;
+        Value value;
+    };
+
+    struct Slots {
+        std::vector<int8_t> ctrl;
+        std::vector<Entry> entries;
+        size_t used = 0;        // Full plus deleted slots
+
+        bool empty() const { return ctrl.empty(); }
+        size_t capacity() const { return ctrl.size(); }
+        size_t groups() const { return ctrl.size() / kGroupWidth; }
+
+        void reset(size_t groups) {
+            ctrl.assign(groups * kGroupWidth, kEmpty);
+            entries.assign(groups * kGroupWidth, Entry{});
+            used = 0;
+        }
+
+        size_t memory_bytes() const {
+            return ctrl.capacity() + entries.capacity() * sizeof(Entry);
+        }
+
+        template<typename F>
+        void for_each_entry(F& f) const {
+            for (size_t i = 0; i < ctrl.size(); ++i) {
+                if (ctrl[i] >= 0) {
+                    f(entries[i].key, entries[i].value);
+                }
+            }
+        }
+    };
+
+    Slots current_;
+    Slots old_;                 // Being drained into current_ while non-empty
+    size_t migrated_groups_ = 0;
+    size_t size_ = 0;
+
+    static uint64_t hash_of(const Key& key) {
+        // Spread weak hashes (std::hash of integers is the identity)
+        uint64_t h = static_cast<uint64_t>(Hash()(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static int8_t tag_of(uint64_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+    static size_t group_of(uint64_t hash) { return static_cast<size_t>(hash >> 7); }
+
+    // Bit i set where group byte i equals tag
+    static uint32_t match(const int8_t* group, int8_t tag) {
+#if defined(__SSE2__)
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag))));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; ++i) {
+            if (group[i] == tag) {
+                mask |= 1u << i;
+            }
+        }
+        return mask;
+#endif
+    }
+
+    // Bit i set where group byte i is empty or deleted (sign bit set)
+    static uint32_t match_free(const int8_t* group) {
+#if defined(__SSE2__)
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; ++i) {
+            if (group[i] < 0) {
+                mask |= 1u << i;
+            }
+        }
+        return mask;
+#endif
+    }
+
+    // Probe groups in triangular order, which visits every group when the
+    // group count is a power of two; f returns true to stop
+    template<typename F>
+    static void probe(const Slots& slots, uint64_t hash, F&& f) {
+        size_t mask = slots.groups() - 1;
+        size_t group = group_of(hash) & mask;
+        for (size_t step = 1; step <= slots.groups(); ++step) {
+            if (f(group * kGroupWidth)) {
+                return;
+            }
+            group = (group + step) & mask;
+        }
+    }
+
+    template<typename F>
+    static void find_in(const Slots& slots, uint64_t hash, const Key& key, F& f) {
+        if (slots.empty()) return;
+        int8_t tag = tag_of(hash);
+        probe(slots, hash, [&](size_t base) {
+            const int8_t* group = &slots.ctrl[base];
+            for (uint32_t m = match(group, tag); m; m &= m - 1) {
+                const Entry& entry = slots.entries[base + __builtin_ctz(m)];
+                if (KeyEqual()(entry.key, key)) {
+                    f(entry.value);
+                }
+            }
+            // A group with an empty slot ends the probe sequence
+            return match(group, kEmpty) != 0;
+        });
+    }
+
+    static void insert_into(Slots& slots, uint64_t hash, const Key& key, const Value& value) {
+        probe(slots, hash, [&](size_t base) {
+            uint32_t free = match_free(&slots.ctrl[base]);
+            if (!free) return false;
+            size_t i = base + __builtin_ctz(free);
+            if (slots.ctrl[i] == kEmpty) {
+                slots.used++;
+            }
+            slots.ctrl[i] = tag_of(hash);
+            slots.entries[i] = Entry{key, value};
+            return true;
+        });
+    }
+
+    static bool erase_from(Slots& slots, uint64_t hash, const Key& key, const Value& value) {
+        if (slots.empty()) return false;
+        int8_t tag = tag_of(hash);
+        bool erased = false;
+        probe(slots, hash, [&](size_t base) {
+            const int8_t* group = &slots.ctrl[base];
+            for (uint32_t m = match(group, tag); m; m &= m - 1) {
+                size_t i = base + __builtin_ctz(m);
+                Entry& entry = slots.entries[i];
+                if (KeyEqual()(entry.key, key) && entry.value == value) {
+                    slots.ctrl[i] = kDeleted;
+                    entry = Entry{};
+                    erased = true;
+                    return true;
+                }
+            }
+            return match(group, kEmpty) != 0;
+        });
+        return erased;
+    }
+
+    // Keep full plus deleted slots at or below 7/8 of capacity
+    bool needs_growth() const {
+        return current_.empty() || (current_.used + 1) * 8 > current_.capacity() * 7;
+    }
+
+    void start_growth() {
+        // Finish any earlier move first so at most two arrays exist
+        while (!old_.empty()) {
+            migrate_some();
+        }
+
+        size_t groups = kMinGroups;
+        // Size for the live entries (tombstones are dropped by the move)
+        while (groups * kGroupWidth * 7 < (size_ + 1) * 8 * 2) {
+            groups *= 2;
+        }
+
+        old_ = std::move(current_);
+        current_ = Slots();
+        current_.reset(groups);
+        migrated_groups_ = 0;
+    }
+
+    void migrate_some() {
+        if (old_.empty()) return;
+
+        for (size_t n = 0; n < kMigrateGroupsPerOp && migrated_groups_ < old_.groups(); ++n) {
+            size_t base = migrated_groups_ * kGroupWidth;
+            for (size_t i = base; i < base + kGroupWidth; ++i) {
+                if (old_.ctrl[i] >= 0) {
+                    Entry& entry = old_.entries[i];
+                    insert_into(current_, hash_of(entry.key), entry.key, entry.value);
+                    old_.ctrl[i] = kDeleted;
+                    entry = Entry{};
+                }
+            }
+            migrated_groups_++;
+        }
+
+        if (migrated_groups_ == old_.groups()) {
+            old_ = Slots();
+        }
+    }
+};
+
+} // namespace storage
+} // namespace toydb
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace toydb {
+namespace storage {
+
+enum class IOOp {
+    Read,
+    Write,
+    Fsync
+};
+
+// A single asynchronous I/O request
+struct IORequest {
+    IOOp op = IOOp::Read;
+    int fd = -1;
+    void* buffer = nullptr;   // Unused for Fsync
+    size_t length = 0;
+    uint64_t offset = 0;
+    int buffer_index = -1;    // Index into the registered buffers, or -1
+    bool link_next = false;   // Start the next request only after this one completes
+    uint64_t user_data = 0;   // Handed back unchanged in the completion
+};
+
+// Result of a completed request
+struct IOCompletion {
+    uint64_t user_data;
+    int64_t result;           // Bytes transferred (0 for Fsync) or -errno
+};
+
+// Asynchronous I/O interface used by the storage layer for page reads,
+// log appends and checkpoint writes. Requests are queued with prepare(),
+// issued in batches by submit() and collected with reap().
+//
+// Requests that fail before reaching the device (e.g. io_uring_enter errors,
+// or an io_uring chain of linked requests longer than the queue depth)
+// still complete through reap(), with a negative errno.
+//
+// A backend instance is not thread-safe; each I/O issuing thread owns one.
+class IOBackend {
+public:
+    virtual ~IOBackend() = default;
+
+    // Queue a request; nothing is issued until submit()
+    virtual void prepare(const IORequest& request) = 0;
+
+    // Issue all queued requests; returns how many were submitted
+    virtual size_t submit() = 0;
+
+    // Wait for at least min_complete completions and append every available
+    // completion to out; returns the number appended. A min_complete of 0
+    // only collects completions that are already available.
+    virtual size_t reap(std::vector<IOCompletion>& out, size_t min_complete = 1) = 0;
+
+    // Register buffers that are reused for many requests (e.g. buffer pool
+    // frames) so the kernel can skip mapping them on every I/O
+    virtual bool register_buffers(const std::vector<std::pair<void*, size_t>>& buffers) = 0;
+
+    // Number of submitted requests that have not been reaped yet
+    virtual size_t in_flight() const = 0;
+
+    virtual const char* name() const = 0;
+};
+
+enum class IOBackendKind {
+    Auto,        // io_uring when the kernel supports it, thread pool otherwise
+    IoUring,
+    ThreadPool
+};
+
+// Create an I/O backend. Returns nullptr only if IoUring was explicitly
+// requested and is not available.
+std::unique_ptr<IOBackend> make_io_backend(IOBackendKind kind = IOBackendKind::Auto,
+                                           unsigned queue_depth = 256);
+
+// Synchronously run a single request through a backend (convenience for
+// callers that do not batch)
+int64_t run_io(IOBackend& backend, const IORequest& request);
+
+} // namespace storage
+} // namespace toydb
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <functional>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include "skiplist.h"
+#include "thread_pool.h"
+
+namespace toydb {
+namespace storage {
+
+struct LsmOptions {
+    std::string directory;                  // Run files; created if missing
+    size_t memtable_bytes = 4 << 20;        // Memtable size that triggers a flush
+    size_t level0_runs = 4;                 // Level 0 runs that trigger a compaction
+    size_t level0_stall_runs = 12;          // Level 0 runs at which writers wait for compaction
+    size_t level1_bytes = 32 << 20;         // Target size of level 1
+    size_t level_size_ratio = 10;           // Each level is this much larger than the last
+    size_t block_bytes = 4096;              // Target size of a run's data blocks
+};
+
+struct LsmStats {
+    size_t memtable_entries = 0;
+    size_t memtable_bytes = 0;      // Active and flushing memtables
+    size_t runs = 0;
+    size_t levels = 0;              // Levels holding at least one run
+    size_t disk_bytes = 0;          // Run files
+    size_t index_bytes = 0;         // Block indexes and Bloom filters kept in memory
+};
+
+// Log-structured merge tree over byte-string keys and values.
+//
+// Writes go to a skip list memtable. A full memtable becomes immutable and
+// a background job writes it to disk as a sorted run. Runs land in level 0,
+// where they may overlap. Once level 0 holds level0_runs runs they are
+// merged with level 1, and any level over its size target is merged into
+// the next one, so every level below 0 is a single sorted run. Flushes and
+// compactions run on separate worker threads, so a long compaction does not
+// hold up the next flush; writers only stall if the next memtable fills
+// before the last flush finishes, or if level 0 reaches level0_stall_runs.
+//
+// Deletes write tombstones, which shadow older versions until a compaction
+// into the bottom level drops them. Lookups check the memtables and then
+// the runs newest first; each run keeps its block index and a Bloom filter
+// in memory, so a run that cannot hold the key costs no I/O.
+//
+// A flush or compaction that fails (e.g. the disk is full) leaves its
+// memtable or input runs in place and puts the tree in a failed state:
+// reads go on, but every later write and flush throws std::runtime_error,
+// including writers already stalled waiting for the failed job.
+//
+// Keys compare bytewise (see KeyCodec). Runs are spill files for the
+// lifetime of the tree, not a durable format: there is no log or manifest,
+// and the directory is removed when the tree is destroyed.
+//
+// All methods are thread-safe.
+class LsmTree {
+public:
+    explicit LsmTree(LsmOptions options);
+    ~LsmTree();
+
+    LsmTree(const LsmTree&) = delete;
+    LsmTree& operator=(const LsmTree&) = delete;
+
+    void put(const std::string& key, std::string value);
+    void remove(const std::string& key);
+
+    std::optional<std::string> get(const std::string& key) const;
+    bool contains(const std::string& key) const { return get(key).has_value(); }
+
+    // Visit live entries with keys >= start in key order until func returns
+    // false. Writes from func would deadlock; collect first, then write.
+    void scan(const std::string& start,
+              const std::function<bool(const std::string&, const std::string&)>& func) const;
+
+    // Write the memtable out and wait for resulting compactions
+    void flush();
+
+    LsmStats stats() const;
+
+private:
+    class SortedRun;
+    class MergeIterator;
+
+    struct Entry {
+        std::string value;
+        bool deleted = false;
+    };
+    using MemTable = SkipList<std::string, Entry>;
+    using RunPtr = std::shared_ptr<const SortedRun>;
+
+    LsmOptions options_;
+
+    mutable std::shared_mutex mutex_;
+    std::condition_variable_any writable_;    // Signalled when a stall may be over
+    std::unique_ptr<MemTable> memtable_;
+    size_t memtable_bytes_ = 0;
+    std::shared_ptr<const MemTable> immutable_;     // Being flushed, if any
+    size_t immutable_bytes_ = 0;
+    std::vector<std::vector<RunPtr>> levels_;       // Level 0 newest first
+    std::atomic<uint64_t> next_run_id_{1};
+    std::atomic<bool> compacting_{false};
+    std::string background_error_;    // First flush or compaction failure
+
+    // One thread flushes, the other compacts
+    ThreadPool worker_{2};
+
+    void write(const std::string& key, Entry entry);
+    void schedule_flush(std::unique_lock<std::shared_mutex>& lock);
+    void flush_immutable();
+    void schedule_compaction();
+    void compact();
+    // Record a failed background job and wake stalled writers
+    void fail_background(const std::string& error);
+    // Throw if a background job has failed; called with mutex_ held
+    void check_background_error() const;
+
+    size_t level_target_bytes(size_t level) const;
+    std::string run_path(uint64_t id) const;
+};
+
+} // namespace storage
+} // namespace toydb
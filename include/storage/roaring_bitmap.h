@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace toydb {
+namespace storage {
+
+// Compressed bitmap of 32-bit integers in the style of Roaring: values are
+// split by their high 16 bits into containers, each holding the low 16 bits
+// either as a sorted array (up to kArrayMax values) or as a 65536-bit
+// bitmap. Sparse chunks stay small and dense ones turn AND/OR into word
+// operations, done 128 bits at a time with SSE2 where available. Unlike
+// Roaring, AND keeps bitmap results as bitmaps, and there are no run-length
+// containers.
+class RoaringBitmap {
+public:
+    static constexpr size_t kArrayMax = 4096;
+
+    void add(uint32_t value);
+    void remove(uint32_t value);
+    bool contains(uint32_t value) const;
+
+    size_t cardinality() const;
+    bool empty() const { return containers_.empty(); }
+    void clear() { containers_.clear(); }
+
+    RoaringBitmap& operator&=(const RoaringBitmap& other);
+    RoaringBitmap& operator|=(const RoaringBitmap& other);
+
+    friend RoaringBitmap operator&(RoaringBitmap a, const RoaringBitmap& b) { return a &= b; }
+    friend RoaringBitmap operator|(RoaringBitmap a, const RoaringBitmap& b) { return a |= b; }
+
+    // Call func with every value in increasing order
+    template<typename Func>
+    void for_each(Func&& func) const {
+        for (const auto& c : containers_) {
+            uint32_t high = uint32_t{c.key} << 16;
+            if (c.is_bitmap()) {
+                for (size_t w = 0; w < kBitmapWords; ++w) {
+                    uint64_t word = c.bits[w];
+                    while (word) {
+                        func(high | static_cast<uint32_t>(w * 64 + __builtin_ctzll(word)));
+                        word &= word - 1;
+                    }
+                }
+            } else {
+                for (uint16_t low : c.array) {
+                    func(high | low);
+                }
+            }
+        }
+    }
+
+    // Approximate bytes held by the containers
+    size_t memory_bytes() const;
+
+private:
+    static constexpr size_t kBitmapWords = 65536 / 64;
+
+    // One 2^16 chunk of the value space; bits is empty for array containers
+    struct Container {
+        uint16_t key = 0;
+        uint32_t cardinality = 0;
+        std::vector<uint16_t> array;
+        std::vector<uint64_t> bits;
+
+        bool is_bitmap() const { return !bits.empty(); }
+        void to_bitmap();
+        void to_array();
+    };
+
+    std::vector<Container> containers_;     // Sorted by key
+
+    Container* find(uint16_t key);
+    const Container* find(uint16_t key) const;
+
+    static Container intersect(const Container& a, const Container& b);
+    static Container unite(const Container& a, const Container& b);
+};
+
+} // namespace storage
+} // namespace toydb
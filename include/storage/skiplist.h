@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <utility>
+
+namespace toydb {
+namespace storage {
+
+// Ordered map on a skip list, used as the LSM memtable. Nodes are carved
+// out of a monotonic arena with their tower of next pointers inline, so an
+// insert is one bump allocation and dropping the whole list frees every
+// node at once. Entries are never unlinked; overwrites replace the value in
+// place and deletes are the caller's business (LSM tombstones).
+//
+// Not thread-safe: one writer, or any number of readers once the list is
+// no longer written.
+template<typename Key, typename Value, typename Compare = std::less<Key>>
+class SkipList {
+    struct Node;
+
+public:
+    static constexpr int kMaxHeight = 12;
+
+    SkipList() : rng_(0x5eed) {
+        head_ = new_node(kMaxHeight, Key(), Value());
+    }
+
+    ~SkipList() {
+        // The arena releases the memory; keys and values may own heap data
+        Node* node = head_;
+        while (node) {
+            Node* next = node->next[0];
+            node->~Node();
+            node = next;
+        }
+    }
+
+    SkipList(const SkipList&) = delete;
+    SkipList& operator=(const SkipList&) = delete;
+
+    // Insert a key or replace its value; returns true if the key was new
+    bool insert_or_assign(const Key& key, Value value) {
+        Node* prev[kMaxHeight];
+        Node* node = find_greater_or_equal(key, prev);
+        if (node && !less_(key, node->key)) {
+            node->value = std::move(value);
+            return false;
+        }
+
+        int height = random_height();
+        if (height > height_) {
+            for (int level = height_; level < height; ++level) {
+                prev[level] = head_;
+            }
+            height_ = height;
+        }
+
+        node = new_node(height, key, std::move(value));
+        for (int level = 0; level < height; ++level) {
+            node->next[level] = prev[level]->next[level];
+            prev[level]->next[level] = node;
+        }
+        size_++;
+        return true;
+    }
+
+    const Value* find(const Key& key) const {
+        Node* node = find_greater_or_equal(key, nullptr);
+        if (node && !less_(key, node->key)) {
+            return &node->value;
+        }
+        return nullptr;
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // Forward iterator over entries in key order
+    class Iterator {
+    public:
+        bool valid() const { return node_ != nullptr; }
+        const Key& key() const { return node_->key; }
+        const Value& value() const { return node_->value; }
+        void next() { node_ = node_->next[0]; }
+
+    private:
+        friend class SkipList;
+        Node* node_ = nullptr;
+    };
+
+    Iterator begin() const {
+        Iterator it;
+        it.node_ = head_->next[0];
+        return it;
+    }
+
+    // First entry with a key >= key
+    Iterator lower_bound(const Key& key) const {
+        Iterator it;
+        it.node_ = find_greater_or_equal(key, nullptr);
+        return it;
+    }
+
+private:
+    struct Node {
+        Key key;
+        Value value;
+        Node* next[1];      // Really height entries, allocated inline
+
+        Node(const Key& k, Value v) : key(k), value(std::move(v)) {}
+    };
+
+    std::pmr::monotonic_buffer_resource arena_{64 * 1024};
+    Node* head_;
+    int height_ = 1;
+    size_t size_ = 0;
+    std::minstd_rand rng_;
+    Compare less_;
+
+    Node* new_node(int height, const Key& key, Value value) {
+        size_t bytes = sizeof(Node) + sizeof(Node*) * (height - 1);
+        void* memory = arena_.allocate(bytes, alignof(Node));
+        Node* node = new (memory) Node(key, std::move(value));
+        for (int level = 0; level < height; ++level) {
+            node->next[level] = nullptr;
+        }
+        return node;
+    }
+
+    // Each level up holds a quarter of the nodes of the one below
+    int random_height() {
+        int height = 1;
+        while (height < kMaxHeight && (rng_() & 3) == 0) {
+            height++;
+        }
+        return height;
+    }
+
+    // First node >= key; fills prev with the last node before it per level
+    Node* find_greater_or_equal(const Key& key, Node** prev) const {
+        Node* node = head_;
+        for (int level = height_ - 1; level >= 0; --level) {
+            Node* next = node->next[level];
+            while (next && less_(next->key, key)) {
+                node = next;
+                next = node->next[level];
+            }
+            if (prev) {
+                prev[level] = node;
+            }
+        }
+        return node->next[0];
+    }
+};
+
+} // namespace storage
+} // namespace toydb
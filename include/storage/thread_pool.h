@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace toydb {
+namespace storage {
+
+// Fixed-size pool of worker threads running queued tasks in FIFO order
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t num_threads = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queue a task for execution on one of the workers
+    void submit(std::function<void()> task);
+
+    // Block until the queue is empty and no task is running
+    void wait_idle();
+
+    size_t size() const { return workers_.size(); }
+
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable task_available_;
+    std::condition_variable idle_;
+    size_t active_ = 0;
+    bool stopping_ = false;
+
+    void worker_loop();
+};
+
+} // namespace storage
+} // namespace toydb
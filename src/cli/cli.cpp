@@ -1,4 +1,6 @@
 #include "../../include/cli/cli.h"
+#include "../../include/metrics/metrics.h"
+#include "../../include/metrics/trace.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -41,6 +43,14 @@ void CLI::start() {
                 print_help();
                 command.clear();
                 continue;
+            } else if (trimmed == "metrics") {
+                metrics::Registry::instance().dump(std::cout);
+                command.clear();
+                continue;
+            } else if (trimmed.compare(0, 6, "trace ") == 0) {
+                write_trace(trimmed.substr(6));
+                command.clear();
+                continue;
             }
             
             is_complete = !command.empty() && command.back() == ';';
@@ -57,7 +67,17 @@ void CLI::start() {
 }
 
 void CLI::execute_command(const std::string& command) {
-    auto statement = parser_.parse(command);
+    db::ArenaScope arena_scope(arena_);
+    auto& slow_log = metrics::SlowQueryLog::instance();
+    profiling_ = slow_log.enabled();
+    profile_ = metrics::QueryProfile{};
+    auto start = std::chrono::steady_clock::now();
+    TOYDB_TRACE_SPAN("query", "query");
+    
+    auto statement = [&] {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::parse));
+        return parser_.parse(command);
+    }();
     
     if (!statement) {
         std::cerr << "Error: " << parser_.last_error() << std::endl;
@@ -70,6 +90,8 @@ void CLI::execute_command(const std::string& command) {
             
             if constexpr (std::is_same_v<T, parser::CreateTableStmt>) {
                 handle_create_table(stmt);
+            } else if constexpr (std::is_same_v<T, parser::CreateIndexStmt>) {
+                handle_create_index(stmt);
             } else if constexpr (std::is_same_v<T, parser::InsertStmt>) {
                 handle_insert(stmt);
             } else if constexpr (std::is_same_v<T, parser::SelectStmt>) {
@@ -82,6 +104,10 @@ void CLI::execute_command(const std::string& command) {
                 handle_drop_table(stmt);
             } else if constexpr (std::is_same_v<T, parser::ShowTablesStmt>) {
                 handle_show_tables(stmt);
+            } else if constexpr (std::is_same_v<T, parser::ShowTableStatusStmt>) {
+                handle_show_table_status(stmt);
+            } else if constexpr (std::is_same_v<T, parser::ShowMetricsStmt>) {
+                handle_show_metrics(stmt);
             } else if constexpr (std::is_same_v<T, parser::BeginTransactionStmt>) {
                 handle_begin_transaction(stmt);
             } else if constexpr (std::is_same_v<T, parser::CommitTransactionStmt>) {
@@ -93,6 +119,20 @@ void CLI::execute_command(const std::string& command) {
     } catch (const std::exception& e) {
         std::cerr << "Error executing command: " << e.what() << std::endl;
     }
+    
+    if (profiling_) {
+        profile_.total = std::chrono::steady_clock::now() - start;
+        profile_.sql = command;
+        slow_log.record(std::move(profile_));
+    }
+}
+
+void CLI::record_scan(const db::ScanStats& stats, size_t rows_returned) {
+    if (profiling_) {
+        profile_.access_path = stats.access_path;
+        profile_.rows_examined = stats.rows_examined;
+        profile_.rows_returned = rows_returned;
+    }
 }
 
 void CLI::handle_create_table(const parser::CreateTableStmt& stmt) {
@@ -102,11 +142,23 @@ void CLI::handle_create_table(const parser::CreateTableStmt& stmt) {
         columns.push_back(parser::convert_column_def(col));
     }
     
-    if (db_->create_table(stmt.table_name, columns)) {
+    if (db_->create_table(stmt.table_name, columns, parser::convert_storage_engine(stmt))) {
         std::cout << "Table created: " << stmt.table_name << std::endl;
     }
 }
 
+void CLI::handle_create_index(const parser::CreateIndexStmt& stmt) {
+    auto table = db_->get_table(stmt.table_name);
+    if (!table) {
+        std::cerr << "Table not found: " << stmt.table_name << std::endl;
+        return;
+    }
+    
+    if (db_->create_index(stmt.table_name, parser::convert_index_def(stmt, table->columns()))) {
+        std::cout << "Index created: " << stmt.index_name << std::endl;
+    }
+}
+
 void CLI::handle_insert(const parser::InsertStmt& stmt) {
     auto table = db_->get_table(stmt.table_name);
     if (!table) {
@@ -119,54 +171,28 @@ void CLI::handle_insert(const parser::InsertStmt& stmt) {
     // Process each row
     size_t success_count = 0;
     for (const auto& value_strs : stmt.values) {
-        auto row = parse_row(value_strs, columns, stmt.columns);
+        db::Row row;
+        {
+            metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+            row = parse_row(value_strs, columns, stmt.columns);
+        }
+        
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::execute));
         if (table->insert_row(row)) {
             success_count++;
         }
     }
     
+    if (profiling_) {
+        profile_.rows_returned = success_count;
+    }
     std::cout << success_count << " row(s) inserted." << std::endl;
 }
 
 db::Row CLI::parse_row(const std::vector<std::string>& value_strs, 
                        const std::vector<db::ColumnDef>& columns,
                        const std::vector<std::string>& col_names) {
-    db::Row row;
-    
-    // If column names are specified, map values to the correct columns
-    if (!col_names.empty()) {
-        // Initialize all columns to NULL
-        row.resize(columns.size(), db::DBNull{});
-        
-        if (value_strs.size() != col_names.size()) {
-            throw std::runtime_error("Column count mismatch");
-        }
-        
-        for (size_t i = 0; i < col_names.size(); ++i) {
-            // Find column index
-            auto col_idx = std::find_if(columns.begin(), columns.end(), 
-                                      [&](const db::ColumnDef& col) { 
-                                          return col.name == col_names[i]; 
-                                      }) - columns.begin();
-            
-            if (col_idx >= columns.size()) {
-                throw std::runtime_error("Column not found: " + col_names[i]);
-            }
-            
-            row[col_idx] = parser::parse_value(value_strs[i], columns[col_idx].type);
-        }
-    } else {
-        // Use values in order
-        if (value_strs.size() != columns.size()) {
-            throw std::runtime_error("Column count mismatch");
-        }
-        
-        for (size_t i = 0; i < columns.size(); ++i) {
-            row.push_back(parser::parse_value(value_strs[i], columns[i].type));
-        }
-    }
-    
-    return row;
+    return parser::convert_row(value_strs, columns, col_names);
 }
 
 void CLI::handle_select(const parser::SelectStmt& stmt) {
@@ -179,16 +205,45 @@ void CLI::handle_select(const parser::SelectStmt& stmt) {
     const auto& columns = table->columns();
     
     // Convert parser conditions to DB conditions
-    std::vector<db::Condition> conditions;
-    for (const auto& cond : stmt.conditions) {
-        conditions.push_back(parser::convert_condition(cond, columns));
+    db::Conditions conditions(arena_.resource());
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+        TOYDB_TRACE_SPAN("plan", "query");
+        for (const auto& cond : stmt.conditions) {
+            conditions.push_back(parser::convert_condition(cond, columns));
+        }
+    }
+    
+    // Resolve the selected columns; SELECT * keeps them all
+    std::vector<size_t> projection;
+    std::vector<db::ColumnDef> output;
+    for (const auto& name : stmt.columns) {
+        auto idx = table->column_index(name);
+        if (!idx) {
+            std::cerr << "Column not found: " << name << std::endl;
+            return;
+        }
+        projection.push_back(*idx);
+        output.push_back(columns[*idx]);
+    }
+    if (stmt.columns.empty()) {
+        output = columns;
     }
     
     // Execute the query
-    auto rows = table->select(conditions);
+    db::ScanStats stats;
+    std::vector<db::Row> rows;
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::execute));
+        rows = projection.empty() ? table->select(conditions, &stats)
+                                  : table->select(conditions, projection, &stats);
+    }
+    record_scan(stats, rows.size());
     
     // Print the results
-    print_results(rows, columns);
+    metrics::PhaseTimer timer(phase(&metrics::QueryProfile::format));
+    TOYDB_TRACE_SPAN("format", "query");
+    print_results(rows, output);
 }
 
 void CLI::print_results(const std::vector<db::Row>& rows, const std::vector<db::ColumnDef>& columns) {
@@ -244,9 +299,13 @@ void CLI::handle_update(const parser::UpdateStmt& stmt) {
     const auto& columns = table->columns();
     
     // Convert parser conditions to DB conditions
-    std::vector<db::Condition> conditions;
-    for (const auto& cond : stmt.conditions) {
-        conditions.push_back(parser::convert_condition(cond, columns));
+    db::Conditions conditions(arena_.resource());
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+        TOYDB_TRACE_SPAN("plan", "query");
+        for (const auto& cond : stmt.conditions) {
+            conditions.push_back(parser::convert_condition(cond, columns));
+        }
     }
     
     // Convert update assignments
@@ -261,11 +320,18 @@ void CLI::handle_update(const parser::UpdateStmt& stmt) {
             }
         }
         
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
         updates[col_name] = parser::parse_value(value_str, col_type);
     }
     
     // Execute the update
-    size_t count = table->update(updates, conditions);
+    db::ScanStats stats;
+    size_t count;
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::execute));
+        count = table->update(updates, conditions, &stats);
+    }
+    record_scan(stats, count);
     std::cout << count << " row(s) updated." << std::endl;
 }
 
@@ -279,13 +345,23 @@ void CLI::handle_delete(const parser::DeleteStmt& stmt) {
     const auto& columns = table->columns();
     
     // Convert parser conditions to DB conditions
-    std::vector<db::Condition> conditions;
-    for (const auto& cond : stmt.conditions) {
-        conditions.push_back(parser::convert_condition(cond, columns));
+    db::Conditions conditions(arena_.resource());
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+        TOYDB_TRACE_SPAN("plan", "query");
+        for (const auto& cond : stmt.conditions) {
+            conditions.push_back(parser::convert_condition(cond, columns));
+        }
     }
     
     // Execute the delete
-    size_t count = table->remove(conditions);
+    db::ScanStats stats;
+    size_t count;
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::execute));
+        count = table->remove(conditions, &stats);
+    }
+    record_scan(stats, count);
     std::cout << count << " row(s) deleted." << std::endl;
 }
 
@@ -322,6 +398,20 @@ void CLI::handle_show_tables(const parser::ShowTablesStmt& stmt) {
     std::cout << table_names.size() << " table(s) found." << std::endl;
 }
 
+void CLI::handle_show_metrics(const parser::ShowMetricsStmt&) {
+    std::vector<db::ColumnDef> columns = {{"METRIC", db::ColumnType::Text},
+                                          {"VALUE", db::ColumnType::Text}};
+    std::vector<db::Row> rows;
+    for (const auto& [name, value] : metrics::Registry::instance().rows()) {
+        rows.push_back({name, value});
+    }
+    print_results(rows, columns);
+}
+
+void CLI::handle_show_table_status(const parser::ShowTableStatusStmt&) {
+    print_results(db_->table_status_rows(), db::Database::table_status_columns());
+}
+
 void CLI::handle_begin_transaction(const parser::BeginTransactionStmt& stmt) {
     uint64_t transaction_id = db_->begin_transaction();
     std::cout << "Transaction started with ID: " << transaction_id << std::endl;
@@ -345,17 +435,42 @@ void CLI::handle_abort_transaction(const parser::AbortTransactionStmt& stmt) {
     }
 }
 
+void CLI::write_trace(const std::string& path) const {
+    if (!metrics::kTracingEnabled) {
+        std::cerr << "Tracing is not compiled in (configure with -DTOYDB_TRACING=ON)" << std::endl;
+        return;
+    }
+    if (metrics::write_chrome_trace(path)) {
+        std::cout << "Trace written to " << path << std::endl;
+    } else {
+        std::cerr << "Cannot write trace: " << path << std::endl;
+    }
+}
+
 void CLI::print_help() const {
     std::cout << "ToyDB Help:\n"
               << "----------\n"
               << "Commands end with ';' and are case-insensitive.\n\n"
-              << "CREATE TABLE table_name (col1 TYPE [PRIMARY KEY] [NOT NULL], ...);\n"
+              << "CREATE TABLE table_name (col1 TYPE [PRIMARY KEY] [NOT NULL], ...) [ENGINE = HEAP|LSM];\n"
               << "  - Create a new table with specified columns\n"
-              << "  - Supported types: INT, FLOAT, TEXT\n\n"
+              << "  - Supported types: INT, FLOAT, TEXT\n"
+              << "  - LSM tables need an INT or TEXT primary key and suit write-heavy use\n\n"
+              << "CREATE INDEX index_name ON table_name (column[, ...]) [INCLUDE (column[, ...])]\n"
+              << "    [USING BTREE|HASH|ART|BITMAP] [WHERE conditions];\n"
+              << "  - Index a column; HASH serves only '=' lookups, ART is an ordered radix tree,\n"
+              << "    BITMAP suits low-cardinality columns and combines across AND-ed conditions\n"
+              << "  - BTREE indexes may list several columns; they serve '=' on a leftmost prefix\n"
+              << "    of them plus a range on the next one\n"
+              << "  - BTREE indexes may INCLUDE extra columns; SELECTs touching only stored\n"
+              << "    columns are answered from the index without reading rows\n"
+              << "  - WHERE makes a partial index of only the matching rows, used by queries\n"
+              << "    whose conditions imply it\n\n"
               << "INSERT INTO table_name [(col1, col2, ...)] VALUES (val1, val2, ...), ...;\n"
               << "  - Insert one or more rows\n\n"
               << "SELECT col1, col2, ... FROM table_name [WHERE conditions];\n"
-              << "  - Query data (use * for all columns)\n\n"
+              << "  - Query data (use * for all columns)\n"
+              << "  - Conditions are col op value or col IN (val, ...), combined with AND and\n"
+              << "    OR (AND binds tighter) and grouped with parentheses\n\n"
               << "UPDATE table_name SET col1 = val1, ... [WHERE conditions];\n"
               << "  - Update rows matching conditions\n\n"
               << "DELETE FROM table_name [WHERE conditions];\n"
@@ -364,6 +479,10 @@ void CLI::print_help() const {
               << "  - Remove a table\n\n"
               << "SHOW TABLES;\n"
               << "  - List all tables in the database\n\n"
+              << "SHOW TABLE STATUS;\n"
+              << "  - Show row counts, memory use and index shape per table\n\n"
+              << "SHOW METRICS;\n"
+              << "  - Show engine counters and latency percentiles\n\n"
               << "Transaction commands:\n"
               << "BEGIN TRANSACTION;\n"
               << "  - Start a new transaction and get a transaction ID\n\n"
@@ -373,6 +492,8 @@ void CLI::print_help() const {
               << "  - Abort/rollback a transaction by ID\n\n"
               << "Special commands (without semicolon):\n"
               << "  help - Display this help\n"
+              << "  metrics - Print a plain-text dump of all metrics\n"
+              << "  trace FILE - Write recorded trace spans as Chrome trace JSON\n"
               << "  exit/quit - Exit ToyDB\n";
 }
 
@@ -9,7 +9,8 @@ Database::Database(const std::string& name)
     : name_(name) {
 }
 
-bool Database::create_table(const std::string& name, const std::vector<ColumnDef>& columns) {
+bool Database::create_table(const std::string& name, const std::vector<ColumnDef>& columns,
+                            StorageEngine engine) {
     if (table_exists(name)) {
         std::cerr << "Table already exists: " << name << std::endl;
         return false;
@@ -17,6 +18,7 @@ bool Database::create_table(const std::string& name, const std::vector<ColumnDef
     
     // Validate column definitions
     bool has_primary_key = false;
+    bool keyable = false;
     for (const auto& col : columns) {
         if (col.primary_key) {
             if (has_primary_key) {
@@ -24,10 +26,17 @@ bool Database::create_table(const std::string& name, const std::vector<ColumnDef
                 return false;
             }
             has_primary_key = true;
+            keyable = col.type == ColumnType::Int || col.type == ColumnType::Text;
         }
     }
     
-    tables_[name] = std::make_shared<Table>(name, columns);
+    // LSM tables store rows by primary key
+    if (engine == StorageEngine::Lsm && !keyable) {
+        std::cerr << "LSM tables need an INT or TEXT primary key" << std::endl;
+        return false;
+    }
+    
+    tables_[name] = std::make_shared<Table>(name, columns, engine);
     return true;
 }
 
@@ -41,6 +50,15 @@ bool Database::drop_table(const std::string& name) {
     return true;
 }
 
+bool Database::create_index(const std::string& table_name, const IndexDef& def) {
+    auto table = get_table(table_name);
+    if (!table) {
+        std::cerr << "Table doesn't exist: " << table_name << std::endl;
+        return false;
+    }
+    return table->create_index(def);
+}
+
 std::shared_ptr<Table> Database::get_table(const std::string& name) const {
     auto it = tables_.find(name);
     if (it != tables_.end()) {
@@ -61,5 +79,56 @@ bool Database::table_exists(const std::string& name) const {
     return tables_.find(name) != tables_.end();
 }
 
+const std::vector<ColumnDef>& Database::table_status_columns() {
+    static const std::vector<ColumnDef> columns = {
+        {"TABLE_NAME", ColumnType::Text},
+        {"ENGINE", ColumnType::Text},
+        {"ROWS", ColumnType::Int},
+        {"DATA_BYTES", ColumnType::Int},
+        {"INDEX_BYTES", ColumnType::Int},
+        {"DISK_BYTES", ColumnType::Int},
+        {"INDEXES", ColumnType::Int},
+        {"LEAF_NODES", ColumnType::Int},
+        {"INTERNAL_NODES", ColumnType::Int},
+        {"TREE_HEIGHT", ColumnType::Int},
+        {"FILL_FACTOR", ColumnType::Float},
+    };
+    return columns;
+}
+
+std::vector<Row> Database::table_status_rows() const {
+    auto names = list_tables();
+    std::sort(names.begin(), names.end());
+    
+    std::vector<Row> rows;
+    for (const auto& name : names) {
+        TableStatus status = tables_.at(name)->status();
+        rows.push_back({name,
+                        engine_to_string(status.engine),
+                        static_cast<DBInt>(status.row_count),
+                        static_cast<DBInt>(status.data_bytes),
+                        static_cast<DBInt>(status.index_bytes),
+                        static_cast<DBInt>(status.disk_bytes),
+                        static_cast<DBInt>(status.secondary_indexes),
+                        static_cast<DBInt>(status.index.leaf_nodes),
+                        static_cast<DBInt>(status.index.internal_nodes),
+                        static_cast<DBInt>(status.index.height),
+                        status.index.fill_factor});
+    }
+    return rows;
+}
+
+uint64_t Database::begin_transaction() {
+    return TransactionManager::instance().begin_transaction();
+}
+
+void Database::commit_transaction(uint64_t id) {
+    TransactionManager::instance().commit_transaction(id);
+}
+
+void Database::abort_transaction(uint64_t id) {
+    TransactionManager::instance().abort_transaction(id);
+}
+
 } // namespace db
 } // namespace toydb 
\ No newline at end of file
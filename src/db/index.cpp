@@ -0,0 +1,541 @@
+#include "../../include/db/index.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace toydb {
+namespace db {
+
+std::string index_type_to_string(IndexType type) {
+    switch (type) {
+        case IndexType::BTree: return "BTREE";
+        case IndexType::Hash: return "HASH";
+        case IndexType::Art: return "ART";
+        case IndexType::Bitmap: return "BITMAP";
+        default: return "UNKNOWN";
+    }
+}
+
+bool Index::covers_column(size_t column) const {
+    return std::find(column_positions_.begin(), column_positions_.end(), column) !=
+               column_positions_.end() ||
+           std::find(include_positions_.begin(), include_positions_.end(), column) !=
+               include_positions_.end();
+}
+
+bool Index::indexes_row(const Row& row, const std::vector<ColumnDef>& columns) const {
+    for (const auto& condition : def_.where) {
+        if (!condition.evaluate(row, columns)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Index::filters_on(const std::string& column) const {
+    return std::any_of(def_.where.begin(), def_.where.end(),
+                       [&column](const Condition& c) { return c.column_name == column; });
+}
+
+namespace {
+
+bool is_lower_bound(const std::string& op) { return op == ">" || op == ">="; }
+bool is_upper_bound(const std::string& op) { return op == "<" || op == "<="; }
+
+// Whether every value satisfying query also satisfies predicate, both on
+// the same column, under the ordering compare_values uses
+bool implies(const Condition& query, const Condition& predicate) {
+    const DBValue& q = query.value;
+    const DBValue& p = predicate.value;
+    if (query.op == "=") {
+        return compare_values(q, predicate.op, p);
+    }
+    if (query.op == "IN") {
+        return std::all_of(query.values.begin(), query.values.end(), [&](const DBValue& v) {
+            return compare_values(v, predicate.op, p);
+        });
+    }
+    if (query.op == predicate.op && values_equal(q, p)) {
+        return true;
+    }
+    
+    // A bound implies a looser bound on the same side, and rules out the
+    // values beyond it
+    bool strict = query.op == ">" || query.op == "<";
+    if (is_lower_bound(query.op)) {
+        if (is_lower_bound(predicate.op)) {
+            return values_less(p, q) || (values_equal(p, q) && (strict || predicate.op == ">="));
+        }
+        return predicate.op == "!=" && (values_less(p, q) || (values_equal(p, q) && strict));
+    }
+    if (is_upper_bound(query.op)) {
+        if (is_upper_bound(predicate.op)) {
+            return values_less(q, p) || (values_equal(p, q) && (strict || predicate.op == "<="));
+        }
+        return predicate.op == "!=" && (values_less(q, p) || (values_equal(p, q) && strict));
+    }
+    return false;
+}
+
+} // namespace
+
+bool Index::usable_for(const Conditions& conditions) const {
+    for (const auto& predicate : def_.where) {
+        bool implied = std::any_of(conditions.begin(), conditions.end(),
+            [&predicate](const Condition& c) {
+                return c.column_name == predicate.column_name && implies(c, predicate);
+            });
+        if (!implied) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<RowPositions> Index::lookup_in(const Condition& condition) const {
+    std::vector<DBValue> values = condition.values;
+    std::sort(values.begin(), values.end(), values_less);
+    values.erase(std::unique(values.begin(), values.end(), values_equal), values.end());
+    
+    // Distinct values find disjoint rows, so only the order needs fixing
+    Condition probe{condition.column_name, "=", DBValue()};
+    RowPositions positions;
+    for (auto& value : values) {
+        probe.value = std::move(value);
+        auto matches = lookup(probe);
+        if (!matches) {
+            return std::nullopt;
+        }
+        positions.insert(positions.end(), matches->begin(), matches->end());
+    }
+    std::sort(positions.begin(), positions.end());
+    return positions;
+}
+
+// HashIndex implementation
+void HashIndex::insert(const Row& row, size_t position) {
+    table_.insert(key_of(row), position);
+}
+
+void HashIndex::erase(const Row& row, size_t position) {
+    table_.erase(key_of(row), position);
+}
+
+void HashIndex::clear() {
+    table_.clear();
+}
+
+std::optional<RowPositions> HashIndex::lookup(const Condition& condition) const {
+    if (condition.op != "=") {
+        return std::nullopt;
+    }
+
+    RowPositions positions;
+    table_.for_each(condition.value, [&positions](size_t position) {
+        positions.push_back(position);
+    });
+    return positions;
+}
+
+size_t HashIndex::memory_bytes() const {
+    size_t bytes = table_.memory_bytes();
+    table_.for_each_entry([&bytes](const DBValue& key, size_t) {
+        if (const auto* text = std::get_if<DBText>(&key)) {
+            bytes += storage::heap_bytes(*text);
+        }
+    });
+    return bytes;
+}
+
+namespace {
+
+// Rows of an ordered (value, position) index matching one condition.
+// DBValue's ordering (by type, then value) is the same one values_less
+// uses, NULL first, so each operator maps to one contiguous key range.
+template<typename Tree>
+std::optional<RowPositions> ordered_lookup(const Tree& tree, const Condition& condition) {
+    using Key = std::pair<DBValue, size_t>;
+    constexpr size_t kMaxPosition = std::numeric_limits<size_t>::max();
+    const DBValue& value = condition.value;
+    const std::string& op = condition.op;
+
+    Key start;
+    std::function<bool(const DBValue&)> in_range;
+    if (op == "=") {
+        start = {value, 0};
+        in_range = [&value](const DBValue& key) { return key == value; };
+    } else if (op == ">") {
+        start = {value, kMaxPosition};
+        in_range = [](const DBValue&) { return true; };
+    } else if (op == ">=") {
+        start = {value, 0};
+        in_range = [](const DBValue&) { return true; };
+    } else if (op == "<") {
+        start = {DBNull{}, 0};
+        in_range = [&value](const DBValue& key) { return key < value; };
+    } else if (op == "<=") {
+        start = {DBNull{}, 0};
+        in_range = [&value](const DBValue& key) { return key <= value; };
+    } else {
+        return std::nullopt;
+    }
+
+    RowPositions positions;
+    tree.scan_from(start, [&](const Key& key, size_t position) {
+        if (!in_range(key.first)) {
+            return false;
+        }
+        positions.push_back(position);
+        return true;
+    });
+    return positions;
+}
+
+} // namespace
+
+// BTreeIndex implementation
+void BTreeIndex::insert(const Row& row, size_t position) {
+    tree_.insert({key_of(row), position}, position);
+}
+
+void BTreeIndex::erase(const Row& row, size_t position) {
+    tree_.remove({key_of(row), position});
+}
+
+void BTreeIndex::clear() {
+    tree_ = storage::BPlusTree<Key, size_t, 64>();
+}
+
+std::optional<RowPositions> BTreeIndex::lookup(const Condition& condition) const {
+    return ordered_lookup(tree_, condition);
+}
+
+size_t BTreeIndex::memory_bytes() const {
+    return tree_.stats().bytes;
+}
+
+// ArtIndex implementation
+void ArtIndex::insert(const Row& row, size_t position) {
+    tree_.insert({key_of(row), position}, position);
+}
+
+void ArtIndex::erase(const Row& row, size_t position) {
+    tree_.remove({key_of(row), position});
+}
+
+void ArtIndex::clear() {
+    tree_ = storage::AdaptiveRadixTree<Key, size_t>();
+}
+
+std::optional<RowPositions> ArtIndex::lookup(const Condition& condition) const {
+    return ordered_lookup(tree_, condition);
+}
+
+size_t ArtIndex::memory_bytes() const {
+    return tree_.stats().bytes;
+}
+
+// BitmapIndex implementation
+void BitmapIndex::insert(const Row& row, size_t position) {
+    if (position > kMaxPosition) {
+        throw std::out_of_range("Row position does not fit in a bitmap index");
+    }
+    bitmaps_[key_of(row)].add(static_cast<uint32_t>(position));
+}
+
+void BitmapIndex::erase(const Row& row, size_t position) {
+    auto it = bitmaps_.find(key_of(row));
+    if (it == bitmaps_.end() || position > kMaxPosition) {
+        return;
+    }
+    it->second.remove(static_cast<uint32_t>(position));
+    if (it->second.empty()) {
+        bitmaps_.erase(it);
+    }
+}
+
+void BitmapIndex::clear() {
+    bitmaps_.clear();
+}
+
+storage::RoaringBitmap BitmapIndex::lookup_bitmap(const Condition& condition) const {
+    if (condition.op == "=") {
+        auto it = bitmaps_.find(condition.value);
+        return it != bitmaps_.end() ? it->second : storage::RoaringBitmap();
+    }
+    if (condition.op == "IN") {
+        storage::RoaringBitmap rows;
+        for (const auto& value : condition.values) {
+            auto it = bitmaps_.find(value);
+            if (it != bitmaps_.end()) {
+                rows |= it->second;
+            }
+        }
+        return rows;
+    }
+
+    // Few distinct values, so test each one
+    storage::RoaringBitmap rows;
+    for (const auto& [value, bitmap] : bitmaps_) {
+        if (compare_values(value, condition.op, condition.value)) {
+            rows |= bitmap;
+        }
+    }
+    return rows;
+}
+
+std::optional<RowPositions> BitmapIndex::lookup(const Condition& condition) const {
+    RowPositions positions;
+    lookup_bitmap(condition).for_each([&positions](uint32_t position) {
+        positions.push_back(position);
+    });
+    return positions;
+}
+
+size_t BitmapIndex::memory_bytes() const {
+    size_t bytes = 0;
+    for (const auto& [value, bitmap] : bitmaps_) {
+        // Map node: the key, the bitmap and the tree links
+        bytes += sizeof(DBValue) + sizeof(bitmap) + 4 * sizeof(void*) + bitmap.memory_bytes();
+        if (const auto* text = std::get_if<DBText>(&value)) {
+            bytes += storage::heap_bytes(*text);
+        }
+    }
+    return bytes;
+}
+
+// CompositeIndex implementation
+std::string CompositeIndex::encode(const Row& row, size_t position) const {
+    std::string key;
+    for (size_t column : column_positions_) {
+        storage::KeyCodec<DBValue>::encode(row[column], key);
+    }
+    storage::KeyCodec<uint64_t>::encode(position, key);
+    return key;
+}
+
+void CompositeIndex::insert(const Row& row, size_t position) {
+    Entry entry{position, {}};
+    entry.included.reserve(include_positions_.size());
+    for (size_t column : include_positions_) {
+        entry.included.push_back(row[column]);
+    }
+    tree_.insert(encode(row, position), entry);
+}
+
+void CompositeIndex::erase(const Row& row, size_t position) {
+    tree_.remove(encode(row, position));
+}
+
+void CompositeIndex::clear() {
+    tree_ = storage::BPlusTree<std::string, Entry, 64>();
+}
+
+PrefixMatch CompositeIndex::match(const Conditions& conditions) const {
+    PrefixMatch match;
+    for (const auto& column : def_.columns) {
+        const Condition* equality = nullptr;
+        for (const auto& condition : conditions) {
+            if (condition.column_name == column && condition.op == "=") {
+                equality = &condition;
+                break;
+            }
+        }
+        if (equality) {
+            match.equalities.push_back(equality);
+            continue;
+        }
+
+        // The first column without an equality may still bound the scan
+        for (const auto& condition : conditions) {
+            if (condition.column_name != column) {
+                continue;
+            }
+            if (!match.lower && (condition.op == ">" || condition.op == ">=")) {
+                match.lower = &condition;
+            } else if (!match.upper && (condition.op == "<" || condition.op == "<=")) {
+                match.upper = &condition;
+            }
+        }
+        break;
+    }
+    return match;
+}
+
+std::optional<RowPositions> CompositeIndex::lookup(const Condition& condition) const {
+    if (condition.column_name != def_.columns[0]) {
+        return std::nullopt;
+    }
+    PrefixMatch match;
+    if (condition.op == "=") {
+        match.equalities.push_back(&condition);
+    } else if (condition.op == ">" || condition.op == ">=") {
+        match.lower = &condition;
+    } else if (condition.op == "<" || condition.op == "<=") {
+        match.upper = &condition;
+    } else {
+        return std::nullopt;
+    }
+    return lookup(match);
+}
+
+RowPositions CompositeIndex::lookup(const PrefixMatch& match) const {
+    RowPositions positions;
+    scan(match, [&positions](const std::string&, const Entry& entry) {
+        positions.push_back(entry.position);
+    });
+    return positions;
+}
+
+size_t CompositeIndex::scan_stored(const PrefixMatch& match, size_t width,
+                                   const std::function<void(const Row&, size_t)>& func) const {
+    size_t visited = 0;
+    Row row(width);
+    scan(match, [&](const std::string& key, const Entry& entry) {
+        size_t offset = 0;
+        for (size_t column : column_positions_) {
+            row[column] = storage::KeyCodec<DBValue>::decode(key, offset);
+        }
+        for (size_t i = 0; i < include_positions_.size(); ++i) {
+            row[include_positions_[i]] = entry.included[i];
+        }
+        func(row, entry.position);
+        visited++;
+    });
+    return visited;
+}
+
+void CompositeIndex::scan(const PrefixMatch& match,
+                          const std::function<void(const std::string&, const Entry&)>& func) const {
+    // Keys with the equality values all start with prefix; within them the
+    // next column's encoding orders the bounds
+    std::string prefix;
+    for (const Condition* equality : match.equalities) {
+        storage::KeyCodec<DBValue>::encode(equality->value, prefix);
+    }
+    std::string lower = prefix;
+    if (match.lower) {
+        storage::KeyCodec<DBValue>::encode(match.lower->value, lower);
+    }
+    std::string upper = prefix;
+    if (match.upper) {
+        storage::KeyCodec<DBValue>::encode(match.upper->value, upper);
+    }
+    bool exclusive_lower = match.lower && match.lower->op == ">";
+    bool exclusive_upper = match.upper && match.upper->op == "<";
+
+    tree_.scan_from(lower, [&](const std::string& key, const Entry& entry) {
+        if (key.compare(0, prefix.size(), prefix) != 0) {
+            return false;
+        }
+        if (exclusive_lower && key.compare(0, lower.size(), lower) == 0) {
+            return true;
+        }
+        if (match.upper) {
+            int order = key.compare(0, upper.size(), upper);
+            if (order > 0 || (order == 0 && exclusive_upper)) {
+                return false;
+            }
+        }
+        func(key, entry);
+        return true;
+    });
+}
+
+size_t CompositeIndex::memory_bytes() const {
+    size_t bytes = tree_.stats().bytes;
+    if (include_positions_.empty()) {
+        return bytes;
+    }
+    // The tree counts each Entry's sizeof; add what the INCLUDE values own
+    tree_.scan_from(std::string(), [&bytes](const std::string&, const Entry& entry) {
+        bytes += entry.included.capacity() * sizeof(DBValue);
+        for (const auto& value : entry.included) {
+            if (const auto* text = std::get_if<DBText>(&value)) {
+                bytes += storage::heap_bytes(*text);
+            }
+        }
+        return true;
+    });
+    return bytes;
+}
+
+std::unique_ptr<Index> make_index(IndexDef def, std::vector<size_t> column_positions,
+                                  std::vector<size_t> include_positions) {
+    if (def.type == IndexType::BTree && (def.columns.size() > 1 || !def.include.empty())) {
+        return std::make_unique<CompositeIndex>(std::move(def), std::move(column_positions),
+                                                std::move(include_positions));
+    }
+    if (def.type == IndexType::Hash) {
+        return std::make_unique<HashIndex>(std::move(def), std::move(column_positions));
+    }
+    if (def.type == IndexType::Art) {
+        return std::make_unique<ArtIndex>(std::move(def), std::move(column_positions));
+    }
+    if (def.type == IndexType::Bitmap) {
+        return std::make_unique<BitmapIndex>(std::move(def), std::move(column_positions));
+    }
+    return std::make_unique<BTreeIndex>(std::move(def), std::move(column_positions));
+}
+
+} // namespace db
+
+namespace storage {
+
+void KeyCodec<db::DBValue>::encode(const db::DBValue& value, std::string& out) {
+    out.push_back(static_cast<char>(value.index()));
+    if (const auto* i = std::get_if<db::DBInt>(&value)) {
+        KeyCodec<int64_t>::encode(*i, out);
+    } else if (const auto* f = std::get_if<db::DBFloat>(&value)) {
+        // Flip all bits of negatives and the sign bit of positives so the
+        // IEEE bit patterns sort numerically; -0.0 is encoded as 0.0
+        double d = *f == 0.0 ? 0.0 : *f;
+        uint64_t bits;
+        std::memcpy(&bits, &d, sizeof(bits));
+        bits = (bits >> 63) ? ~bits : bits ^ (uint64_t{1} << 63);
+        KeyCodec<uint64_t>::encode(bits, out);
+    } else if (const auto* t = std::get_if<db::DBText>(&value)) {
+        KeyCodec<std::string>::encode(*t, out);
+    }
+}
+
+db::DBValue KeyCodec<db::DBValue>::decode(const std::string& in, size_t& offset) {
+    auto read_u64 = [&in, &offset]() {
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i) {
+            bits = (bits << 8) | static_cast<unsigned char>(in[offset++]);
+        }
+        return bits;
+    };
+
+    size_t tag = static_cast<unsigned char>(in[offset++]);
+    if (tag == 1) {
+        return static_cast<db::DBInt>(read_u64() ^ (uint64_t{1} << 63));
+    }
+    if (tag == 2) {
+        // Undo encode's flip: encoded positives have the top bit set
+        uint64_t bits = read_u64();
+        bits = (bits >> 63) ? bits ^ (uint64_t{1} << 63) : ~bits;
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        return d;
+    }
+    if (tag == 3) {
+        std::string text;
+        while (offset + 1 < in.size()) {
+            char c = in[offset++];
+            if (c == '\0') {
+                if (in[offset++] == '\0') {
+                    break;
+                }
+            }
+            text.push_back(c);
+        }
+        return text;
+    }
+    return db::DBNull{};
+}
+
+} // namespace storage
+} // namespace toydb
@@ -0,0 +1,258 @@
+#include "../../include/db/table.h"
+#include "../../include/db/index.h"
+#include "../../include/storage/lsm_tree.h"
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <unistd.h>
+
+// Table operations for the LSM storage engine. Rows are stored in the LSM
+// tree under their memcmp-encoded primary key, so point lookups by primary
+// key are LSM gets and everything else is a merged scan in key order.
+
+namespace toydb {
+namespace db {
+
+namespace {
+
+// Where LSM tables put their run files: $TOYDB_LSM_DIR, or the system
+// temporary directory, plus a directory per table instance
+std::string lsm_directory(const std::string& table) {
+    static std::atomic<uint64_t> next_id{1};
+    const char* base = std::getenv("TOYDB_LSM_DIR");
+    std::filesystem::path root = base && *base ? std::filesystem::path(base)
+                                               : std::filesystem::temp_directory_path() / "toydb-lsm";
+    return (root / (std::to_string(::getpid()) + "-" + table + "-" +
+                    std::to_string(next_id++))).string();
+}
+
+std::string encode_key(const DBValue& value) {
+    std::string key;
+    storage::KeyCodec<DBValue>::encode(value, key);
+    return key;
+}
+
+// Row values, each a one-byte type tag followed by 8 bytes for INT and
+// FLOAT or a u32 length and the bytes for TEXT
+std::string encode_row(const Row& row) {
+    std::string out;
+    for (const auto& value : row) {
+        out.push_back(static_cast<char>(value.index()));
+        if (const auto* i = std::get_if<DBInt>(&value)) {
+            out.append(reinterpret_cast<const char*>(i), sizeof(*i));
+        } else if (const auto* f = std::get_if<DBFloat>(&value)) {
+            out.append(reinterpret_cast<const char*>(f), sizeof(*f));
+        } else if (const auto* t = std::get_if<DBText>(&value)) {
+            uint32_t size = static_cast<uint32_t>(t->size());
+            out.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            out += *t;
+        }
+    }
+    return out;
+}
+
+Row decode_row(const std::string& data, size_t columns) {
+    Row row;
+    row.reserve(columns);
+    const char* p = data.data();
+    for (size_t i = 0; i < columns; ++i) {
+        switch (*p++) {
+            case 1: {
+                DBInt value;
+                std::memcpy(&value, p, sizeof(value));
+                p += sizeof(value);
+                row.emplace_back(value);
+                break;
+            }
+            case 2: {
+                DBFloat value;
+                std::memcpy(&value, p, sizeof(value));
+                p += sizeof(value);
+                row.emplace_back(value);
+                break;
+            }
+            case 3: {
+                uint32_t size;
+                std::memcpy(&size, p, sizeof(size));
+                p += sizeof(size);
+                row.emplace_back(DBText(p, size));
+                p += size;
+                break;
+            }
+            default:
+                row.emplace_back(DBNull{});
+                break;
+        }
+    }
+    return row;
+}
+
+} // namespace
+
+void Table::open_lsm() {
+    storage::LsmOptions options;
+    options.directory = lsm_directory(name_);
+    lsm_ = std::make_unique<storage::LsmTree>(std::move(options));
+}
+
+bool Table::lsm_insert(const Row& row) {
+    const DBValue& pk = row[*primary_key_index_];
+    if (std::holds_alternative<DBNull>(pk)) {
+        std::cerr << "NULL value in primary key column: "
+                  << columns_[*primary_key_index_].name << std::endl;
+        return false;
+    }
+
+    std::string key = encode_key(pk);
+    if (lsm_->contains(key)) {
+        std::cerr << "Duplicate primary key: " << value_to_string(pk) << std::endl;
+        return false;
+    }
+    try {
+        lsm_->put(key, encode_row(row));
+    } catch (const std::exception& e) {
+        std::cerr << "Insert failed: " << e.what() << std::endl;
+        return false;
+    }
+    lsm_rows_++;
+    return true;
+}
+
+size_t Table::lsm_scan(const Conditions& conditions, const char** access_path,
+                       const std::function<void(Row&)>& func) const {
+    // Primary key equality is a single get
+    const auto& pk_column = columns_[*primary_key_index_];
+    for (const auto& condition : conditions) {
+        if (condition.column_name != pk_column.name || condition.op != "=" ||
+            value_type(condition.value) != pk_column.type) {
+            continue;
+        }
+
+        *access_path = "pk_index";
+        auto data = lsm_->get(encode_key(condition.value));
+        if (!data) {
+            return 0;
+        }
+        Row row = decode_row(*data, columns_.size());
+        if (row_matches(row, conditions)) {
+            func(row);
+        }
+        return 1;
+    }
+    
+    // A primary key IN list is a get per distinct key, in key order
+    for (const auto& condition : conditions) {
+        if (condition.column_name != pk_column.name || condition.op != "IN") {
+            continue;
+        }
+        
+        *access_path = "pk_index";
+        std::vector<std::string> keys;
+        for (const auto& value : condition.values) {
+            if (value_type(value) == pk_column.type) {
+                keys.push_back(encode_key(value));
+            }
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        
+        size_t examined = 0;
+        for (const auto& key : keys) {
+            auto data = lsm_->get(key);
+            if (!data) {
+                continue;
+            }
+            examined++;
+            Row row = decode_row(*data, columns_.size());
+            if (row_matches(row, conditions)) {
+                func(row);
+            }
+        }
+        return examined;
+    }
+
+    *access_path = "full_scan";
+    size_t examined = 0;
+    lsm_->scan(std::string(), [&](const std::string&, const std::string& data) {
+        Row row = decode_row(data, columns_.size());
+        examined++;
+        if (row_matches(row, conditions)) {
+            func(row);
+        }
+        return true;
+    });
+    return examined;
+}
+
+size_t Table::lsm_update(const std::unordered_map<size_t, DBValue>& updates,
+                         const Conditions& conditions, const char** access_path,
+                         size_t* examined) {
+    // The scan holds the tree's read lock, so collect the rows first
+    std::vector<Row> matches;
+    *examined = lsm_scan(conditions, access_path, [&matches](Row& row) {
+        matches.push_back(std::move(row));
+    });
+
+    size_t pk = *primary_key_index_;
+    size_t count = 0;
+    for (auto& row : matches) {
+        std::string old_key = encode_key(row[pk]);
+
+        for (const auto& [col_idx, value] : updates) {
+            // Type mismatches are skipped, as for heap tables; the primary
+            // key cannot become NULL
+            if (std::holds_alternative<DBNull>(value)
+                    ? col_idx == pk
+                    : value_type(value) != columns_[col_idx].type) {
+                continue;
+            }
+            row[col_idx] = value;
+        }
+
+        std::string key = encode_key(row[pk]);
+        if (key != old_key && lsm_->contains(key)) {
+            continue; // Duplicate key, skip update
+        }
+        // The new row goes in before the old key is dropped, so a write that
+        // fails never loses the row; stop at the first failure
+        try {
+            lsm_->put(key, encode_row(row));
+            if (key != old_key) {
+                lsm_->remove(old_key);
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Update failed: " << e.what() << std::endl;
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+size_t Table::lsm_remove(const Conditions& conditions, const char** access_path,
+                         size_t* examined) {
+    std::vector<std::string> keys;
+    size_t pk = *primary_key_index_;
+    *examined = lsm_scan(conditions, access_path, [&keys, pk](Row& row) {
+        keys.push_back(encode_key(row[pk]));
+    });
+
+    size_t count = 0;
+    for (const auto& key : keys) {
+        try {
+            lsm_->remove(key);
+        } catch (const std::exception& e) {
+            std::cerr << "Delete failed: " << e.what() << std::endl;
+            break;
+        }
+        count++;
+    }
+    lsm_rows_ -= count;
+    return count;
+}
+
+} // namespace db
+} // namespace toydb
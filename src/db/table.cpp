@@ -1,11 +1,88 @@
 #include "../../include/db/table.h"
+#include "../../include/db/index.h"
+#include "../../include/db/zone_map.h"
+#include "../../include/storage/lsm_tree.h"
+#include "../../include/metrics/metrics.h"
+#include "../../include/metrics/trace.h"
 #include <iostream>
 #include <algorithm>
 #include <sstream>
+#include <mutex>
 
 namespace toydb {
 namespace db {
 
+// Rows ahead of the current one whose values are prefetched during scans
+constexpr size_t kScanPrefetchDistance = 8;
+
+namespace {
+
+struct TableMetrics {
+    metrics::Counter& selects;
+    metrics::Counter& index_lookups;
+    metrics::Counter& full_scans;
+    metrics::Counter& index_only;
+    metrics::Counter& zone_blocks_skipped;
+    metrics::Counter& rows_scanned;
+    metrics::Counter& rows_returned;
+    metrics::Counter& inserts;
+    metrics::Counter& insert_failures;
+    metrics::Counter& updates;
+    metrics::Counter& rows_updated;
+    metrics::Counter& removes;
+    metrics::Counter& rows_deleted;
+    metrics::Counter& key_filter_negatives;
+    metrics::Counter& key_filter_false_positives;
+    metrics::Histogram& select_latency;
+    metrics::Histogram& insert_latency;
+    metrics::Histogram& update_latency;
+    metrics::Histogram& remove_latency;
+};
+
+TableMetrics& table_metrics() {
+    static TableMetrics m{
+        metrics::counter("table.select"),
+        metrics::counter("table.select.index_lookups"),
+        metrics::counter("table.select.full_scans"),
+        metrics::counter("table.select.index_only"),
+        metrics::counter("table.zone_map.blocks_skipped"),
+        metrics::counter("table.rows_scanned"),
+        metrics::counter("table.rows_returned"),
+        metrics::counter("table.insert"),
+        metrics::counter("table.insert.failures"),
+        metrics::counter("table.update"),
+        metrics::counter("table.rows_updated"),
+        metrics::counter("table.remove"),
+        metrics::counter("table.rows_deleted"),
+        metrics::counter("table.pk_filter.negatives"),
+        metrics::counter("table.pk_filter.false_positives"),
+        metrics::histogram("table.select.latency"),
+        metrics::histogram("table.insert.latency"),
+        metrics::histogram("table.update.latency"),
+        metrics::histogram("table.remove.latency"),
+    };
+    return m;
+}
+
+// Take the table lock, tracing the time spent waiting for it
+template<typename Lock>
+Lock lock_table(std::shared_mutex& mutex) {
+    TOYDB_TRACE_SPAN("table.lock_wait", "lock");
+    return Lock(mutex);
+}
+
+using SharedLock = std::shared_lock<std::shared_mutex>;
+using ExclusiveLock = std::unique_lock<std::shared_mutex>;
+
+// Filter hash of a primary key value; only INT and TEXT keys are indexed
+std::optional<uint64_t> key_hash(const DBValue& key) {
+    if (const auto* i = std::get_if<DBInt>(&key)) return storage::hash_key(*i);
+    if (const auto* t = std::get_if<DBText>(&key)) return storage::hash_key(*t);
+    return std::nullopt;
+}
+
+} // namespace
+
 // Helper functions implementation
 ColumnType value_type(const DBValue& value) {
     if (std::holds_alternative<DBNull>(value)) return ColumnType::Null;
@@ -25,6 +102,14 @@ std::string type_to_string(ColumnType type) {
     }
 }
 
+std::string engine_to_string(StorageEngine engine) {
+    switch (engine) {
+        case StorageEngine::Heap: return "HEAP";
+        case StorageEngine::Lsm: return "LSM";
+        default: return "UNKNOWN";
+    }
+}
+
 std::string value_to_string(const DBValue& value) {
     if (std::holds_alternative<DBNull>(value)) return "NULL";
     if (std::holds_alternative<DBInt>(value)) return std::to_string(std::get<DBInt>(value));
@@ -62,8 +147,27 @@ bool values_less(const DBValue& a, const DBValue& b) {
     return false; // Should never happen
 }
 
+bool compare_values(const DBValue& a, const std::string& op, const DBValue& b) {
+    if (op == "=") return values_equal(a, b);
+    if (op == "!=") return !values_equal(a, b);
+    if (op == "<") return values_less(a, b);
+    if (op == ">") return !values_less(a, b) && !values_equal(a, b);
+    if (op == "<=") return values_less(a, b) || values_equal(a, b);
+    if (op == ">=") return !values_less(a, b);
+    
+    return false; // Unknown operator
+}
+
 // Condition implementation
 bool Condition::evaluate(const Row& row, const std::vector<ColumnDef>& columns) const {
+    if (op == "OR") {
+        return std::any_of(any_of.begin(), any_of.end(), [&](const Conditions& branch) {
+            return std::all_of(branch.begin(), branch.end(), [&](const Condition& condition) {
+                return condition.evaluate(row, columns);
+            });
+        });
+    }
+    
     // Find column index
     size_t col_idx = 0;
     bool found = false;
@@ -77,29 +181,30 @@ bool Condition::evaluate(const Row& row, const std::vector<ColumnDef>& columns)
     
     if (!found || col_idx >= row.size()) return false;
     
-    const DBValue& row_value = row[col_idx];
-    
-    if (op == "=") return values_equal(row_value, value);
-    if (op == "!=") return !values_equal(row_value, value);
-    if (op == "<") return values_less(row_value, value);
-    if (op == ">") return !values_less(row_value, value) && !values_equal(row_value, value);
-    if (op == "<=") return values_less(row_value, value) || values_equal(row_value, value);
-    if (op == ">=") return !values_less(row_value, value);
-    
-    return false; // Unknown operator
+    if (op == "IN") {
+        return std::any_of(values.begin(), values.end(), [&](const DBValue& v) {
+            return values_equal(row[col_idx], v);
+        });
+    }
+    return compare_values(row[col_idx], op, value);
 }
 
 // Table implementation
-Table::Table(const std::string& name, const std::vector<ColumnDef>& columns)
-    : name_(name), columns_(columns), primary_key_index_(std::nullopt) {
+Table::Table(const std::string& name, const std::vector<ColumnDef>& columns,
+             StorageEngine engine)
+    : name_(name), columns_(columns), primary_key_index_(std::nullopt),
+      zone_map_(std::make_unique<ZoneMap>(columns.size())), engine_(engine) {
     
     // Find primary key column if any
     for (size_t i = 0; i < columns.size(); ++i) {
         if (columns[i].primary_key) {
             primary_key_index_ = i;
             
-            // Create appropriate index based on primary key type
-            if (columns[i].type == ColumnType::Int) {
+            // Create appropriate index based on primary key type; LSM
+            // tables are keyed by it instead
+            if (engine_ == StorageEngine::Lsm) {
+                open_lsm();
+            } else if (columns[i].type == ColumnType::Int) {
                 int_index_ = std::make_unique<storage::BPlusTree<DBInt, size_t>>();
             } else if (columns[i].type == ColumnType::Text) {
                 text_index_ = std::make_unique<storage::BPlusTree<DBText, size_t>>();
@@ -109,6 +214,8 @@ Table::Table(const std::string& name, const std::vector<ColumnDef>& columns)
     }
 }
 
+Table::~Table() = default;
+
 std::optional<size_t> Table::column_index(const std::string& name) const {
     for (size_t i = 0; i < columns_.size(); ++i) {
         if (columns_[i].name == name) {
@@ -118,10 +225,57 @@ std::optional<size_t> Table::column_index(const std::string& name) const {
     return std::nullopt;
 }
 
+TableStatus Table::status() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    TableStatus status;
+    status.engine = engine_;
+    
+    if (lsm_) {
+        storage::LsmStats lsm = lsm_->stats();
+        status.row_count = lsm_rows_;
+        status.data_bytes = lsm.memtable_bytes;
+        status.index_bytes = lsm.index_bytes;
+        status.disk_bytes = lsm.disk_bytes;
+        return status;
+    }
+    
+    status.row_count = rows_.size() - dead_rows_;
+    status.data_bytes = rows_.capacity() * sizeof(Row);
+    for (const auto& row : rows_) {
+        status.data_bytes += row.capacity() * sizeof(DBValue);
+        for (const auto& value : row) {
+            if (const auto* text = std::get_if<DBText>(&value)) {
+                status.data_bytes += storage::heap_bytes(*text);
+            }
+        }
+    }
+    
+    if (int_index_) {
+        status.index = int_index_->stats();
+    } else if (text_index_) {
+        status.index = text_index_->stats();
+    }
+    status.index_bytes = status.index.bytes + key_filter_.memory_bytes();
+    for (const auto& index : indexes_) {
+        status.index_bytes += index->memory_bytes();
+    }
+    status.index_bytes += zone_map_->memory_bytes();
+    status.secondary_indexes = indexes_.size();
+    return status;
+}
+
 bool Table::insert_row(const Row& row) {
+    TableMetrics& m = table_metrics();
+    metrics::ScopedTimer timer(m.insert_latency);
+    m.inserts.add();
+    TOYDB_TRACE_SPAN("table.insert", "table");
+    
+    auto lock = lock_table<ExclusiveLock>(mutex_);
+    
     // Verify row size
     if (row.size() != columns_.size()) {
         std::cerr << "Column count mismatch" << std::endl;
+        m.insert_failures.add();
         return false;
     }
     
@@ -133,6 +287,7 @@ bool Table::insert_row(const Row& row) {
         // Check NOT NULL constraint
         if (col.not_null && std::holds_alternative<DBNull>(val)) {
             std::cerr << "NULL value in NOT NULL column: " << col.name << std::endl;
+            m.insert_failures.add();
             return false;
         }
         
@@ -140,27 +295,41 @@ bool Table::insert_row(const Row& row) {
         if (!std::holds_alternative<DBNull>(val) && 
             value_type(val) != col.type) {
             std::cerr << "Type mismatch in column " << col.name << std::endl;
+            m.insert_failures.add();
             return false;
         }
         
-        // Check primary key uniqueness
-        if (col.primary_key && has_index()) {
-            if (primary_key_index_ && i == *primary_key_index_) {
-                if (col.type == ColumnType::Int && 
-                    int_index_->find(std::get<DBInt>(val)).has_value()) {
-                    std::cerr << "Duplicate primary key: " << value_to_string(val) << std::endl;
-                    return false;
-                } else if (col.type == ColumnType::Text && 
-                           text_index_->find(std::get<DBText>(val)).has_value()) {
-                    std::cerr << "Duplicate primary key: " << value_to_string(val) << std::endl;
-                    return false;
-                }
+        // Check primary key uniqueness (LSM tables check on write)
+        if (col.primary_key && has_index() && !lsm_) {
+            if (primary_key_index_ && i == *primary_key_index_ &&
+                find_pk(val).has_value()) {
+                std::cerr << "Duplicate primary key: " << value_to_string(val) << std::endl;
+                m.insert_failures.add();
+                return false;
             }
         }
     }
     
+    if (lsm_) {
+        if (!lsm_insert(row)) {
+            m.insert_failures.add();
+            return false;
+        }
+        return true;
+    }
+    
     // Add row and update index
     size_t row_idx = rows_.size();
+    if (row_idx > BitmapIndex::kMaxPosition) {
+        for (const auto& index : indexes_) {
+            if (index->def().type == IndexType::Bitmap) {
+                std::cerr << "Table is too large for bitmap index " << index->def().name
+                          << std::endl;
+                m.insert_failures.add();
+                return false;
+            }
+        }
+    }
     rows_.push_back(row);
     
     // Update index if we have a primary key
@@ -168,6 +337,13 @@ bool Table::insert_row(const Row& row) {
         update_index(row[*primary_key_index_], row_idx);
     }
     
+    for (auto& index : indexes_) {
+        if (index->indexes_row(row, columns_)) {
+            index->insert(row, row_idx);
+        }
+    }
+    zone_map_->add(row, row_idx);
+    
     return true;
 }
 
@@ -181,9 +357,95 @@ void Table::update_index(const DBValue& key, size_t row_index) {
     } else if (pk_column.type == ColumnType::Text && text_index_) {
         text_index_->insert(std::get<DBText>(key), row_index);
     }
+    
+    if (auto hash = key_hash(key)) {
+        key_filter_.add(*hash);
+        // Keys are never removed from the filter, so size it from the live
+        // rows once it fills up
+        if (key_filter_.overloaded()) {
+            rebuild_key_filter();
+        }
+    }
+}
+
+std::optional<size_t> Table::find_pk(const DBValue& key) const {
+    TableMetrics& m = table_metrics();
+    if (key_filter_enabled_) {
+        auto hash = key_hash(key);
+        if (hash && !key_filter_.may_contain(*hash)) {
+            m.key_filter_negatives.add();
+            return std::nullopt;
+        }
+    }
+    
+    std::optional<size_t> position;
+    if (int_index_ && std::holds_alternative<DBInt>(key)) {
+        position = int_index_->find(std::get<DBInt>(key));
+    } else if (text_index_ && std::holds_alternative<DBText>(key)) {
+        position = text_index_->find(std::get<DBText>(key));
+    }
+    if (key_filter_enabled_ && !position) {
+        m.key_filter_false_positives.add();
+    }
+    return position;
+}
+
+std::vector<std::optional<size_t>> Table::find_pks(const std::vector<DBValue>& keys) const {
+    TableMetrics& m = table_metrics();
+    std::vector<std::optional<size_t>> positions(keys.size());
+    
+    // Split the keys by tree, dropping those the filter rules out
+    std::vector<DBInt> int_keys;
+    std::vector<DBText> text_keys;
+    std::vector<size_t> int_slots;
+    std::vector<size_t> text_slots;
+    std::vector<size_t> unindexed;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (key_filter_enabled_) {
+            auto hash = key_hash(keys[i]);
+            if (hash && !key_filter_.may_contain(*hash)) {
+                m.key_filter_negatives.add();
+                continue;
+            }
+        }
+        if (int_index_ && std::holds_alternative<DBInt>(keys[i])) {
+            int_keys.push_back(std::get<DBInt>(keys[i]));
+            int_slots.push_back(i);
+        } else if (text_index_ && std::holds_alternative<DBText>(keys[i])) {
+            text_keys.push_back(std::get<DBText>(keys[i]));
+            text_slots.push_back(i);
+        } else {
+            unindexed.push_back(i);
+        }
+    }
+    
+    auto place = [&](const auto& found, const std::vector<size_t>& slots) {
+        for (size_t j = 0; j < found.size(); ++j) {
+            positions[slots[j]] = found[j];
+            if (key_filter_enabled_ && !found[j]) {
+                m.key_filter_false_positives.add();
+            }
+        }
+    };
+    if (!int_keys.empty()) {
+        place(int_index_->find_many(int_keys), int_slots);
+    }
+    if (!text_keys.empty()) {
+        place(text_index_->find_many(text_keys), text_slots);
+    }
+    
+    for (size_t slot : unindexed) {
+        for (size_t i = 0; primary_key_index_ && i < rows_.size(); ++i) {
+            if (!rows_[i].empty() && values_equal(rows_[i][*primary_key_index_], keys[slot])) {
+                positions[slot] = i;
+                break;
+            }
+        }
+    }
+    return positions;
 }
 
-bool Table::row_matches(const Row& row, const std::vector<Condition>& conditions) const {
+bool Table::row_matches(const Row& row, const Conditions& conditions) const {
     if (conditions.empty()) return true;
     
     for (const auto& condition : conditions) {
@@ -195,50 +457,481 @@ bool Table::row_matches(const Row& row, const std::vector<Condition>& conditions
     return true;
 }
 
-std::vector<Row> Table::select(const std::vector<Condition>& conditions) const {
-    std::vector<Row> result;
-    
-    // If we have a specific primary key condition, use the index
-    if (primary_key_index_ && conditions.size() == 1) {
-        const auto& condition = conditions[0];
-        if (condition.column_name == columns_[*primary_key_index_].name && 
-            condition.op == "=") {
-            
-            const auto& pk_column = columns_[*primary_key_index_];
+namespace {
+
+// Index composite lookups go through: several key columns or INCLUDE columns
+bool is_composite(const Index& index) {
+    return index.def().columns.size() > 1 || !index.def().include.empty();
+}
+
+// ScanStats access path of a single-column index lookup
+const char* index_path(IndexType type) {
+    switch (type) {
+        case IndexType::Hash: return "hash_index";
+        case IndexType::Art: return "art_index";
+        default: return "btree_index";
+    }
+}
+
+// The secondary index a lookup should use for a set of conditions
+struct IndexChoice {
+    const Index* index = nullptr;
+    const Condition* condition = nullptr;   // Single-column lookup; null for composite
+    PrefixMatch match;                      // Composite lookup
+    int rank = 0;                           // 4-5 equality, 3 IN list, 2 range (composite: sum)
+    bool bitmap = false;                    // Intersect the bitmap indexes instead
+    bool covering = false;                  // Composite index stores every needed column
+};
+
+// Pick the best secondary index: more equality columns first, then IN
+// lists, then a bounded range, and hash probes before tree scans. With needed set, a
+// composite index storing all of those columns wins ties.
+IndexChoice choose_index(const std::vector<std::unique_ptr<Index>>& indexes,
+                         const Conditions& conditions,
+                         const std::vector<size_t>* needed) {
+    IndexChoice choice;
+    int best_rank = 0;
+    size_t best_equalities = 0;
+    size_t bitmap_conditions = 0;
+    for (const auto& condition : conditions) {
+        bool bitmap = false;
+        for (const auto& index : indexes) {
+            if (is_composite(*index) || index->def().columns[0] != condition.column_name ||
+                !index->usable_for(conditions)) {
+                continue;
+            }
+            if (index->def().type == IndexType::Bitmap) {
+                bitmap = true;
+                continue;
+            }
             
-            if (pk_column.type == ColumnType::Int && 
-                std::holds_alternative<DBInt>(condition.value)) {
-                
-                auto row_idx_opt = int_index_->find(std::get<DBInt>(condition.value));
-                if (row_idx_opt && *row_idx_opt < rows_.size()) {
-                    result.push_back(rows_[*row_idx_opt]);
-                }
-                return result;
-                
-            } else if (pk_column.type == ColumnType::Text && 
-                       std::holds_alternative<DBText>(condition.value)) {
-                
-                auto row_idx_opt = text_index_->find(std::get<DBText>(condition.value));
-                if (row_idx_opt && *row_idx_opt < rows_.size()) {
-                    result.push_back(rows_[*row_idx_opt]);
+            bool hash = index->def().type == IndexType::Hash;
+            int rank = 0;
+            if (condition.op == "=") {
+                rank = hash ? 5 : 4;
+            } else if (condition.op == "IN") {
+                rank = 3;
+            } else if (!hash && condition.op != "!=" && condition.op != "OR") {
+                rank = 2;
+            }
+            if (rank > best_rank) {
+                best_rank = rank;
+                choice.index = index.get();
+                choice.condition = &condition;
+                best_equalities = condition.op == "=";
+            }
+        }
+        bitmap_conditions += bitmap;
+    }
+    
+    // Composite indexes rank by the equality prefix they bind, plus the
+    // range on the column after it
+    for (const auto& index : indexes) {
+        if (!is_composite(*index) || !index->usable_for(conditions)) {
+            continue;
+        }
+        PrefixMatch match = static_cast<const CompositeIndex&>(*index).match(conditions);
+        int rank = static_cast<int>(match.equalities.size()) * 4 +
+                   (match.lower || match.upper ? 2 : 0);
+        bool covering = needed && std::all_of(needed->begin(), needed->end(),
+            [&index](size_t column) { return index->covers_column(column); });
+        if (rank > best_rank || (rank > 0 && rank == best_rank && covering && !choice.covering)) {
+            best_rank = rank;
+            choice.index = index.get();
+            choice.condition = nullptr;
+            choice.match = std::move(match);
+            choice.covering = covering;
+            best_equalities = choice.match.equalities.size();
+        }
+    }
+    
+    // Bitmap indexes combine, so they win when they cover more conditions
+    // than the best equality lookup
+    choice.rank = best_rank;
+    choice.bitmap = bitmap_conditions > best_equalities;
+    return choice;
+}
+
+} // namespace
+
+const Condition* Table::pk_condition(const Conditions& conditions) const {
+    if (!primary_key_index_) {
+        return nullptr;
+    }
+    auto indexed = [this](const DBValue& key) {
+        return (int_index_ && std::holds_alternative<DBInt>(key)) ||
+               (text_index_ && std::holds_alternative<DBText>(key));
+    };
+    
+    // An equality beats an IN list
+    const auto& pk_name = columns_[*primary_key_index_].name;
+    const Condition* in_list = nullptr;
+    for (const auto& condition : conditions) {
+        if (condition.column_name != pk_name) {
+            continue;
+        }
+        if (condition.op == "=" && indexed(condition.value)) {
+            return &condition;
+        }
+        if (!in_list && condition.op == "IN" &&
+            std::all_of(condition.values.begin(), condition.values.end(), indexed)) {
+            in_list = &condition;
+        }
+    }
+    return in_list;
+}
+
+std::optional<RowPositions> Table::plan(const Conditions& conditions,
+                                        const char** access_path) const {
+    // Primary key equality finds at most one row, an IN list one per value
+    if (const Condition* condition = pk_condition(conditions)) {
+        *access_path = "pk_index";
+        RowPositions positions;
+        if (condition->op == "IN") {
+            std::vector<DBValue> keys = condition->values;
+            std::sort(keys.begin(), keys.end(), values_less);
+            keys.erase(std::unique(keys.begin(), keys.end(), values_equal), keys.end());
+            for (const auto& position : find_pks(keys)) {
+                if (position && *position < rows_.size()) {
+                    positions.push_back(*position);
                 }
-                return result;
             }
+            std::sort(positions.begin(), positions.end());
+            return positions;
+        }
+        
+        auto position = find_pk(condition->value);
+        if (position && *position < rows_.size()) {
+            positions.push_back(*position);
         }
+        return positions;
     }
     
-    // Otherwise, do a full table scan
-    for (const auto& row : rows_) {
-        if (row_matches(row, conditions)) {
-            result.push_back(row);
+    IndexChoice choice = choose_index(indexes_, conditions, nullptr);
+    if (choice.bitmap) {
+        return bitmap_plan(conditions, access_path);
+    }
+    
+    // An OR with an index plan for every branch beats a range scan, but
+    // not an equality or IN lookup
+    if (choice.rank < 3) {
+        if (auto positions = union_plan(conditions, access_path)) {
+            return positions;
+        }
+    }
+    
+    if (!choice.index) {
+        return std::nullopt;
+    }
+    
+    if (!choice.condition) {
+        *access_path = "composite_index";
+        auto positions = static_cast<const CompositeIndex&>(*choice.index).lookup(choice.match);
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+    
+    if (choice.condition->op == "IN") {
+        auto positions = choice.index->lookup_in(*choice.condition);
+        if (positions) {
+            *access_path = index_path(choice.index->def().type);
+        }
+        return positions;
+    }
+    
+    auto positions = choice.index->lookup(*choice.condition);
+    if (positions) {
+        *access_path = index_path(choice.index->def().type);
+        // Return rows in table order, as a scan would
+        std::sort(positions->begin(), positions->end());
+    }
+    return positions;
+}
+
+size_t Table::scan_rows(const Conditions& conditions, const char** access_path,
+                        const std::function<void(size_t)>& func) const {
+    TOYDB_TRACE_SPAN("table.scan", "scan");
+    auto predicates = zone_map_->predicates(conditions, columns_);
+    size_t visited = 0;
+    size_t skipped = 0;
+    
+    for (size_t begin = 0; begin < rows_.size(); begin += ZoneMap::kBlockRows) {
+        if (!predicates.empty() && !zone_map_->may_match(begin / ZoneMap::kBlockRows, predicates)) {
+            skipped++;
+            continue;
+        }
+        
+        // Each row's values live in their own heap block, so fetch the ones
+        // a few rows ahead to hide the cache misses
+        size_t end = std::min(begin + ZoneMap::kBlockRows, rows_.size());
+        for (size_t i = begin; i < end; ++i) {
+            if (i + kScanPrefetchDistance < end) {
+                __builtin_prefetch(rows_[i + kScanPrefetchDistance].data());
+            }
+            if (rows_[i].empty()) {
+                continue; // Deleted
+            }
+            func(i);
+            visited++;
         }
     }
     
+    TableMetrics& m = table_metrics();
+    m.rows_scanned.add(visited);
+    if (skipped > 0) {
+        m.zone_blocks_skipped.add(skipped);
+        *access_path = "zone_scan";
+    }
+    return visited;
+}
+
+std::optional<RowPositions> Table::union_plan(const Conditions& conditions,
+                                              const char** access_path) const {
+    for (const auto& condition : conditions) {
+        if (condition.op != "OR") {
+            continue;
+        }
+        
+        // Each branch is planned on its own; the union is a superset of
+        // the matches, which the caller filters as usual
+        RowPositions positions;
+        bool indexed = true;
+        for (const auto& branch : condition.any_of) {
+            const char* branch_path = "full_scan";
+            auto matches = plan(branch, &branch_path);
+            if (!matches) {
+                indexed = false;
+                break;
+            }
+            positions.insert(positions.end(), matches->begin(), matches->end());
+        }
+        if (!indexed) {
+            continue;
+        }
+        
+        std::sort(positions.begin(), positions.end());
+        positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+        *access_path = "index_union";
+        return positions;
+    }
+    return std::nullopt;
+}
+
+RowPositions Table::bitmap_plan(const Conditions& conditions, const char** access_path) const {
+    TOYDB_TRACE_SPAN("table.bitmap_plan", "index");
+    std::optional<storage::RoaringBitmap> rows;
+    for (const auto& condition : conditions) {
+        for (const auto& index : indexes_) {
+            if (index->def().type != IndexType::Bitmap ||
+                index->def().columns[0] != condition.column_name ||
+                !index->usable_for(conditions)) {
+                continue;
+            }
+            
+            auto matches = static_cast<const BitmapIndex&>(*index).lookup_bitmap(condition);
+            if (rows) {
+                *rows &= matches;
+            } else {
+                rows = std::move(matches);
+            }
+            break;
+        }
+        if (rows && rows->empty()) {
+            break;
+        }
+    }
+    
+    *access_path = "bitmap_index";
+    RowPositions positions;
+    if (rows) {
+        positions.reserve(rows->cardinality());
+        rows->for_each([&positions](uint32_t position) {
+            positions.push_back(position);
+        });
+    }
+    return positions;
+}
+
+std::vector<Row> Table::select(const Conditions& conditions,
+                              ScanStats* stats) const {
+    TableMetrics& m = table_metrics();
+    metrics::ScopedTimer timer(m.select_latency);
+    m.selects.add();
+    TOYDB_TRACE_SPAN("table.select", "table");
+    
+    auto lock = lock_table<SharedLock>(mutex_);
+    std::vector<Row> result;
+    const char* access_path = "full_scan";
+    size_t examined = 0;
+    
+    if (lsm_) {
+        examined = lsm_scan(conditions, &access_path, [&result](Row& row) {
+            result.push_back(std::move(row));
+        });
+        m.rows_scanned.add(examined);
+    } else if (auto positions = plan(conditions, &access_path)) {
+        // Fetch the candidate rows and check the remaining conditions
+        m.index_lookups.add();
+        for (size_t k = 0; k < positions->size(); ++k) {
+            if (k + kScanPrefetchDistance < positions->size()) {
+                __builtin_prefetch(rows_[(*positions)[k + kScanPrefetchDistance]].data());
+            }
+            
+            const auto& row = rows_[(*positions)[k]];
+            if (row_matches(row, conditions)) {
+                result.push_back(row);
+            }
+        }
+        examined = positions->size();
+    } else {
+        examined = scan_rows(conditions, &access_path, [&](size_t i) {
+            const auto& row = rows_[i];
+            if (row_matches(row, conditions)) {
+                result.push_back(row);
+            }
+        });
+        m.full_scans.add();
+    }
+    
+    m.rows_returned.add(result.size());
+    if (stats) {
+        stats->access_path = access_path;
+        stats->rows_examined = examined;
+        stats->rows_matched = result.size();
+    }
+    return result;
+}
+
+std::vector<Row> Table::select(const Conditions& conditions,
+                              const std::vector<size_t>& projection,
+                              ScanStats* stats) const {
+    std::vector<Row> result;
+    if (select_covering(conditions, projection, result, stats)) {
+        return result;
+    }
+    
+    result = select(conditions, stats);
+    for (auto& row : result) {
+        Row projected;
+        projected.reserve(projection.size());
+        for (size_t column : projection) {
+            projected.push_back(row[column]);
+        }
+        row = std::move(projected);
+    }
     return result;
 }
 
+bool Table::select_covering(const Conditions& conditions, const std::vector<size_t>& projection,
+                            std::vector<Row>& result, ScanStats* stats) const {
+    std::vector<size_t> needed = projection;
+    for (const auto& condition : conditions) {
+        auto column = column_index(condition.column_name);
+        if (!column) {
+            return false;
+        }
+        needed.push_back(*column);
+    }
+    
+    auto lock = lock_table<SharedLock>(mutex_);
+    if (lsm_ || pk_condition(conditions)) {
+        return false;
+    }
+    IndexChoice choice = choose_index(indexes_, conditions, &needed);
+    if (!choice.covering || choice.bitmap) {
+        return false;
+    }
+    
+    TableMetrics& m = table_metrics();
+    metrics::ScopedTimer timer(m.select_latency);
+    m.selects.add();
+    m.index_lookups.add();
+    m.index_only.add();
+    TOYDB_TRACE_SPAN("table.select", "table");
+    
+    // Check the conditions on the stored columns alone, then return the
+    // matches in table order as the other paths do
+    std::vector<std::pair<size_t, Row>> matches;
+    const auto& index = static_cast<const CompositeIndex&>(*choice.index);
+    size_t examined = index.scan_stored(choice.match, columns_.size(),
+        [&](const Row& row, size_t position) {
+            if (!row_matches(row, conditions)) {
+                return;
+            }
+            Row projected;
+            projected.reserve(projection.size());
+            for (size_t column : projection) {
+                projected.push_back(row[column]);
+            }
+            matches.emplace_back(position, std::move(projected));
+        });
+    std::sort(matches.begin(), matches.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    
+    result.reserve(matches.size());
+    for (auto& match : matches) {
+        result.push_back(std::move(match.second));
+    }
+    
+    m.rows_returned.add(result.size());
+    if (stats) {
+        stats->access_path = "index_only_scan";
+        stats->rows_examined = examined;
+        stats->rows_matched = result.size();
+    }
+    return true;
+}
+
+std::vector<std::optional<Row>> Table::get_rows(const std::vector<DBValue>& keys) const {
+    TableMetrics& m = table_metrics();
+    metrics::ScopedTimer timer(m.select_latency);
+    m.selects.add(keys.size());
+    TOYDB_TRACE_SPAN("table.get_rows", "table");
+    
+    auto lock = lock_table<SharedLock>(mutex_);
+    std::vector<std::optional<Row>> rows(keys.size());
+    if (!primary_key_index_) {
+        return rows;
+    }
+    
+    size_t found = 0;
+    if (lsm_) {
+        const auto& pk_column = columns_[*primary_key_index_];
+        Conditions conditions(1);
+        conditions[0].column_name = pk_column.name;
+        conditions[0].op = "=";
+        for (size_t i = 0; i < keys.size(); ++i) {
+            conditions[0].value = keys[i];
+            const char* access_path = "pk_index";
+            lsm_scan(conditions, &access_path, [&](Row& row) {
+                rows[i] = std::move(row);
+                found++;
+            });
+        }
+    } else {
+        auto positions = find_pks(keys);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (positions[i] && *positions[i] < rows_.size()) {
+                rows[i] = rows_[*positions[i]];
+                found++;
+            }
+        }
+    }
+    m.index_lookups.add();
+    m.rows_returned.add(found);
+    return rows;
+}
+
 size_t Table::update(const std::unordered_map<std::string, DBValue>& updates, 
-                     const std::vector<Condition>& conditions) {
+                     const Conditions& conditions,
+                     ScanStats* stats) {
+    TableMetrics& m = table_metrics();
+    metrics::ScopedTimer timer(m.update_latency);
+    m.updates.add();
+    TOYDB_TRACE_SPAN("table.update", "table");
+    
+    auto lock = lock_table<ExclusiveLock>(mutex_);
+    
     // Resolve column indices for updates
     std::unordered_map<size_t, DBValue> col_idx_to_value;
     for (const auto& [col_name, value] : updates) {
@@ -248,72 +941,309 @@ size_t Table::update(const std::unordered_map<std::string, DBValue>& updates,
         }
     }
     
+    // A primary key value the index cannot hold is skipped like any other
+    // type mismatch, before a row or index is touched; the key cannot
+    // become NULL (as in lsm_update)
+    if (!lsm_ && primary_key_index_) {
+        auto pk_update = col_idx_to_value.find(*primary_key_index_);
+        if (pk_update != col_idx_to_value.end() &&
+            (std::holds_alternative<DBNull>(pk_update->second) ||
+             value_type(pk_update->second) != columns_[*primary_key_index_].type)) {
+            col_idx_to_value.erase(pk_update);
+        }
+    }
+    
+    // Secondary indexes whose entries the update can change
+    std::vector<Index*> touched;
+    for (const auto& index : indexes_) {
+        for (const auto& [col_idx, value] : col_idx_to_value) {
+            if (index->covers_column(col_idx) || index->filters_on(columns_[col_idx].name)) {
+                touched.push_back(index.get());
+                break;
+            }
+        }
+    }
+    
+    // Check if we're updating the primary key
+    bool updating_pk = primary_key_index_ && 
+                       col_idx_to_value.find(*primary_key_index_) != col_idx_to_value.end();
+    
     size_t count = 0;
     
-    for (size_t i = 0; i < rows_.size(); ++i) {
+    auto update_row = [&](size_t i) {
         auto& row = rows_[i];
         
-        if (row_matches(row, conditions)) {
-            // Check if we're updating the primary key
-            bool updating_pk = primary_key_index_ && 
-                               col_idx_to_value.find(*primary_key_index_) != col_idx_to_value.end();
-            
-            // If updating primary key, check uniqueness
-            if (updating_pk) {
-                const auto& new_pk_value = col_idx_to_value[*primary_key_index_];
-                const auto& pk_col = columns_[*primary_key_index_];
-                
-                if (pk_col.type == ColumnType::Int) {
-                    auto existing = int_index_->find(std::get<DBInt>(new_pk_value));
-                    if (existing && *existing != i) {
-                        continue; // Duplicate key, skip update
-                    }
-                } else if (pk_col.type == ColumnType::Text) {
-                    auto existing = text_index_->find(std::get<DBText>(new_pk_value));
-                    if (existing && *existing != i) {
-                        continue; // Duplicate key, skip update
-                    }
-                }
+        if (!row_matches(row, conditions)) {
+            return;
+        }
+        
+        // If updating primary key, check uniqueness
+        if (updating_pk) {
+            auto existing = find_pk(col_idx_to_value[*primary_key_index_]);
+            if (existing && *existing != i) {
+                return; // Duplicate key, skip update
             }
-            
-            // Update values
-            for (const auto& [col_idx, value] : col_idx_to_value) {
-                // Check type compatibility
-                if (!std::holds_alternative<DBNull>(value) && 
-                    value_type(value) != columns_[col_idx].type) {
-                    continue; // Type mismatch, skip this field
-                }
-                
-                row[col_idx] = value;
+            remove_from_pk_index(row[*primary_key_index_]);
+        }
+        
+        for (auto* index : touched) {
+            if (index->indexes_row(row, columns_)) {
+                index->erase(row, i);
             }
-            
-            // Update index if primary key was changed
-            if (updating_pk) {
-                update_index(row[*primary_key_index_], i);
+        }
+        
+        // Update values
+        for (const auto& [col_idx, value] : col_idx_to_value) {
+            // Check type compatibility
+            if (!std::holds_alternative<DBNull>(value) && 
+                value_type(value) != columns_[col_idx].type) {
+                continue; // Type mismatch, skip this field
             }
             
-            count++;
+            zone_map_->update(i, col_idx, row[col_idx], value);
+            row[col_idx] = value;
+        }
+        
+        for (auto* index : touched) {
+            if (index->indexes_row(row, columns_)) {
+                index->insert(row, i);
+            }
         }
+        
+        // Update index if primary key was changed
+        if (updating_pk) {
+            update_index(row[*primary_key_index_], i);
+        }
+        
+        count++;
+    };
+    
+    const char* access_path = "full_scan";
+    size_t examined = 0;
+    if (lsm_) {
+        count = lsm_update(col_idx_to_value, conditions, &access_path, &examined);
+        m.rows_scanned.add(examined);
+    } else if (auto positions = plan(conditions, &access_path)) {
+        m.index_lookups.add();
+        for (size_t position : *positions) {
+            update_row(position);
+        }
+        examined = positions->size();
+    } else {
+        examined = scan_rows(conditions, &access_path, update_row);
     }
     
+    m.rows_updated.add(count);
+    if (stats) {
+        stats->access_path = access_path;
+        stats->rows_examined = examined;
+        stats->rows_matched = count;
+    }
     return count;
 }
 
-size_t Table::remove(const std::vector<Condition>& conditions) {
-    // This is a simplified implementation that doesn't update indices properly
-    size_t initial_size = rows_.size();
+size_t Table::remove(const Conditions& conditions, ScanStats* stats) {
+    TableMetrics& m = table_metrics();
+    metrics::ScopedTimer timer(m.remove_latency);
+    m.removes.add();
+    TOYDB_TRACE_SPAN("table.remove", "table");
+    
+    auto lock = lock_table<ExclusiveLock>(mutex_);
+    
+    if (lsm_) {
+        const char* access_path = "full_scan";
+        size_t examined = 0;
+        size_t count = lsm_remove(conditions, &access_path, &examined);
+        m.rows_scanned.add(examined);
+        m.rows_deleted.add(count);
+        if (stats) {
+            stats->access_path = access_path;
+            stats->rows_examined = examined;
+            stats->rows_matched = count;
+        }
+        return count;
+    }
+    
+    const char* access_path = "full_scan";
+    std::vector<size_t> doomed;
+    size_t examined = 0;
+    if (auto positions = plan(conditions, &access_path)) {
+        m.index_lookups.add();
+        for (size_t position : *positions) {
+            if (row_matches(rows_[position], conditions)) {
+                doomed.push_back(position);
+            }
+        }
+        examined = positions->size();
+    } else {
+        examined = scan_rows(conditions, &access_path, [&](size_t i) {
+            if (row_matches(rows_[i], conditions)) {
+                doomed.push_back(i);
+            }
+        });
+    }
+    
+    // Leave a tombstone so the positions of the other rows, and with them
+    // every index, stay valid; only the deleted rows' entries go
+    for (size_t i : doomed) {
+        Row& row = rows_[i];
+        if (primary_key_index_) {
+            remove_from_pk_index(row[*primary_key_index_]);
+        }
+        for (auto& index : indexes_) {
+            if (index->indexes_row(row, columns_)) {
+                index->erase(row, i);
+            }
+        }
+        Row().swap(row);
+    }
+    dead_rows_ += doomed.size();
+    
+    // Once most slots are dead, close the gaps (in order) and rebuild; each
+    // rebuild is paid for by the deletes since the last one
+    if (dead_rows_ > 0 && dead_rows_ * 2 >= rows_.size()) {
+        compact_rows();
+    }
+    
+    m.rows_deleted.add(doomed.size());
+    if (stats) {
+        stats->access_path = access_path;
+        stats->rows_examined = examined;
+        stats->rows_matched = doomed.size();
+    }
+    return doomed.size();
+}
+
+bool Table::create_index(const IndexDef& def) {
+    auto lock = lock_table<ExclusiveLock>(mutex_);
+    
+    if (lsm_) {
+        std::cerr << "Secondary indexes are not supported on LSM tables" << std::endl;
+        return false;
+    }
+    
+    for (const auto& index : indexes_) {
+        if (index->def().name == def.name) {
+            std::cerr << "Index already exists: " << def.name << std::endl;
+            return false;
+        }
+    }
     
-    rows_.erase(
-        std::remove_if(rows_.begin(), rows_.end(), 
-                      [this, &conditions](const Row& row) {
-                          return row_matches(row, conditions);
-                      }),
-        rows_.end()
-    );
+    if (def.columns.empty()) {
+        std::cerr << "Indexes must have at least one column" << std::endl;
+        return false;
+    }
+    if (def.columns.size() > 1 && def.type != IndexType::BTree) {
+        std::cerr << "Only BTREE indexes can have more than one column" << std::endl;
+        return false;
+    }
     
-    // In a real implementation, we would rebuild the indices
+    std::vector<size_t> positions;
+    for (const auto& column : def.columns) {
+        auto idx = column_index(column);
+        if (!idx) {
+            std::cerr << "Column not found: " << column << std::endl;
+            return false;
+        }
+        positions.push_back(*idx);
+    }
     
-    return initial_size - rows_.size();
+    if (!def.include.empty() && def.type != IndexType::BTree) {
+        std::cerr << "Only BTREE indexes can have INCLUDE columns" << std::endl;
+        return false;
+    }
+    std::vector<size_t> include_positions;
+    for (const auto& column : def.include) {
+        auto idx = column_index(column);
+        if (!idx) {
+            std::cerr << "Column not found: " << column << std::endl;
+            return false;
+        }
+        include_positions.push_back(*idx);
+    }
+    
+    for (const auto& condition : def.where) {
+        if (!column_index(condition.column_name)) {
+            std::cerr << "Column not found: " << condition.column_name << std::endl;
+            return false;
+        }
+    }
+    
+    // Bitmaps hold 32-bit row positions
+    if (def.type == IndexType::Bitmap && rows_.size() > BitmapIndex::kMaxPosition + 1) {
+        std::cerr << "Table is too large for a bitmap index" << std::endl;
+        return false;
+    }
+    
+    auto index = make_index(def, std::move(positions), std::move(include_positions));
+    for (size_t i = 0; i < rows_.size(); ++i) {
+        if (!rows_[i].empty() && index->indexes_row(rows_[i], columns_)) {
+            index->insert(rows_[i], i);
+        }
+    }
+    indexes_.push_back(std::move(index));
+    return true;
+}
+
+void Table::remove_from_pk_index(const DBValue& key) {
+    if (int_index_ && std::holds_alternative<DBInt>(key)) {
+        int_index_->remove(std::get<DBInt>(key));
+    } else if (text_index_ && std::holds_alternative<DBText>(key)) {
+        text_index_->remove(std::get<DBText>(key));
+    }
+}
+
+void Table::compact_rows() {
+    rows_.erase(std::remove_if(rows_.begin(), rows_.end(),
+                               [](const Row& row) { return row.empty(); }),
+                rows_.end());
+    dead_rows_ = 0;
+    rebuild_indexes();
+}
+
+void Table::rebuild_indexes() {
+    if (int_index_) {
+        int_index_ = std::make_unique<storage::BPlusTree<DBInt, size_t>>();
+    }
+    if (text_index_) {
+        text_index_ = std::make_unique<storage::BPlusTree<DBText, size_t>>();
+    }
+    for (auto& index : indexes_) {
+        index->clear();
+    }
+    key_filter_.reset(rows_.size() * 2);
+    zone_map_->clear();
+    
+    for (size_t i = 0; i < rows_.size(); ++i) {
+        if (primary_key_index_) {
+            update_index(rows_[i][*primary_key_index_], i);
+        }
+        for (auto& index : indexes_) {
+            if (index->indexes_row(rows_[i], columns_)) {
+                index->insert(rows_[i], i);
+            }
+        }
+        zone_map_->add(rows_[i], i);
+    }
+}
+
+void Table::rebuild_key_filter() {
+    // Twice the live rows leaves room to grow before the next rebuild
+    key_filter_.reset(rows_.size() * 2);
+    if (!primary_key_index_) return;
+    for (const auto& row : rows_) {
+        if (row.empty()) {
+            continue;
+        }
+        if (auto hash = key_hash(row[*primary_key_index_])) {
+            key_filter_.add(*hash);
+        }
+    }
+}
+
+void Table::set_key_filter(bool enabled) {
+    auto lock = lock_table<ExclusiveLock>(mutex_);
+    key_filter_enabled_ = enabled;
 }
 
 } // namespace db
@@ -1,6 +1,40 @@
-#include "transaction.hpp"
+#include "../../include/db/transaction.h"
+#include "../../include/metrics/metrics.h"
+#include "../../include/metrics/trace.h"
 #include <stdexcept>
 
+namespace toydb {
+namespace db {
+
+namespace {
+
+struct TransactionMetrics {
+    metrics::Counter& begins;
+    metrics::Counter& commits;
+    metrics::Counter& aborts;
+    metrics::Histogram& duration;  // Begin to commit
+};
+
+TransactionMetrics& transaction_metrics() {
+    static TransactionMetrics m{
+        metrics::counter("txn.begin"),
+        metrics::counter("txn.commit"),
+        metrics::counter("txn.abort"),
+        metrics::histogram("txn.duration"),
+    };
+    return m;
+}
+
+void record_duration(const Transaction& transaction) {
+    if (metrics::should_sample()) {
+        auto elapsed = std::chrono::steady_clock::now() - transaction.start_time();
+        transaction_metrics().duration.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+}
+
+} // namespace
+
 TransactionManager& TransactionManager::instance() {
     static TransactionManager instance;
     return instance;
@@ -10,26 +44,32 @@ uint64_t TransactionManager::begin_transaction() {
     std::lock_guard<std::mutex> lock(mutex_);
     uint64_t id = next_transaction_id_++;
     transactions_[id] = std::make_unique<Transaction>(id);
+    transaction_metrics().begins.add();
     return id;
 }
 
 void TransactionManager::commit_transaction(uint64_t id) {
+    TOYDB_TRACE_SPAN("txn.commit", "txn");
     std::lock_guard<std::mutex> lock(mutex_);
     auto it = transactions_.find(id);
     if (it == transactions_.end()) {
         throw std::runtime_error("Transaction " + std::to_string(id) + " not found");
     }
     it->second->set_state(Transaction::State::COMMITTED);
+    transaction_metrics().commits.add();
+    record_duration(*it->second);
     transactions_.erase(it);
 }
 
 void TransactionManager::abort_transaction(uint64_t id) {
+    TOYDB_TRACE_SPAN("txn.abort", "txn");
     std::lock_guard<std::mutex> lock(mutex_);
     auto it = transactions_.find(id);
     if (it == transactions_.end()) {
         throw std::runtime_error("Transaction " + std::to_string(id) + " not found");
     }
     it->second->set_state(Transaction::State::ABORTED);
+    transaction_metrics().aborts.add();
     transactions_.erase(it);
 }
 
@@ -39,4 +79,7 @@ Transaction& TransactionManager::get_transaction(uint64_t id) {
         throw std::runtime_error("Transaction " + std::to_string(id) + " not found");
     }
     return *it->second;
-} 
\ No newline at end of file
+} 
+
+} // namespace db
+} // namespace toydb
@@ -0,0 +1,134 @@
+#include "../../include/db/zone_map.h"
+#include "../../include/storage/bplustree.h"
+#include <algorithm>
+
+namespace toydb {
+namespace db {
+
+namespace {
+
+// Whether some value in [min, max] can satisfy "value op operand", under
+// the same ordering Condition::evaluate uses
+bool range_may_match(const DBValue& min, const DBValue& max,
+                     const std::string& op, const DBValue& operand) {
+    if (op == "=") return !values_less(operand, min) && !values_less(max, operand);
+    if (op == "!=") return !values_equal(min, operand) || !values_equal(max, operand);
+    if (op == "<") return values_less(min, operand);
+    if (op == "<=") return !values_less(operand, min);
+    if (op == ">") return values_less(operand, max);
+    if (op == ">=") return !values_less(max, operand);
+    return true; // Unknown operator; let the scan decide
+}
+
+} // namespace
+
+void ZoneMap::widen(ColumnZone& zone, const DBValue& value, bool has_values) {
+    if (!has_values) {
+        zone.min = value;
+        zone.max = value;
+    } else if (values_less(value, zone.min)) {
+        zone.min = value;
+    } else if (values_less(zone.max, value)) {
+        zone.max = value;
+    }
+}
+
+void ZoneMap::add(const Row& row, size_t position) {
+    size_t block_index = position / kBlockRows;
+    if (block_index == blocks_.size()) {
+        blocks_.emplace_back();
+        blocks_.back().columns.resize(columns_);
+    }
+
+    Block& block = blocks_[block_index];
+    for (size_t i = 0; i < columns_ && i < row.size(); ++i) {
+        ColumnZone& zone = block.columns[i];
+        if (std::holds_alternative<DBNull>(row[i])) {
+            zone.nulls++;
+        } else {
+            widen(zone, row[i], block.rows > zone.nulls);
+        }
+    }
+    block.rows++;
+}
+
+void ZoneMap::update(size_t position, size_t column, const DBValue& before,
+                     const DBValue& after) {
+    size_t block_index = position / kBlockRows;
+    if (block_index >= blocks_.size() || column >= columns_) {
+        return;
+    }
+
+    Block& block = blocks_[block_index];
+    ColumnZone& zone = block.columns[column];
+    bool has_values = block.rows > zone.nulls;
+    if (std::holds_alternative<DBNull>(before)) {
+        zone.nulls--;
+    }
+    if (std::holds_alternative<DBNull>(after)) {
+        zone.nulls++;
+    } else {
+        widen(zone, after, has_values);
+    }
+}
+
+ZoneMap::Predicates ZoneMap::predicates(const Conditions& conditions,
+                                        const std::vector<ColumnDef>& columns) const {
+    Predicates predicates;
+    if (blocks_.empty()) {
+        return predicates;
+    }
+    for (const auto& condition : conditions) {
+        for (size_t i = 0; i < columns.size() && i < columns_; ++i) {
+            if (columns[i].name == condition.column_name) {
+                predicates.emplace_back(i, &condition);
+                break;
+            }
+        }
+    }
+    return predicates;
+}
+
+bool ZoneMap::may_match(size_t block_index, const Predicates& predicates) const {
+    const Block& block = blocks_[block_index];
+    for (const auto& [column, condition] : predicates) {
+        const ColumnZone& zone = block.columns[column];
+        auto zone_may_match = [&](const std::string& op, const DBValue& operand) {
+            if (zone.nulls > 0 && compare_values(DBValue(), op, operand)) {
+                return true;
+            }
+            return block.rows > zone.nulls && range_may_match(zone.min, zone.max, op, operand);
+        };
+        
+        bool possible;
+        if (condition->op == "IN") {
+            possible = std::any_of(condition->values.begin(), condition->values.end(),
+                [&](const DBValue& value) { return zone_may_match("=", value); });
+        } else {
+            possible = zone_may_match(condition->op, condition->value);
+        }
+        if (!possible) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t ZoneMap::memory_bytes() const {
+    size_t bytes = blocks_.capacity() * sizeof(Block);
+    for (const auto& block : blocks_) {
+        bytes += block.columns.capacity() * sizeof(ColumnZone);
+        for (const auto& zone : block.columns) {
+            if (const auto* text = std::get_if<DBText>(&zone.min)) {
+                bytes += storage::heap_bytes(*text);
+            }
+            if (const auto* text = std::get_if<DBText>(&zone.max)) {
+                bytes += storage::heap_bytes(*text);
+            }
+        }
+    }
+    return bytes;
+}
+
+} // namespace db
+} // namespace toydb
@@ -1,15 +1,76 @@
 #include <iostream>
 #include <string>
+#include <cstring>
+#include <csignal>
 #include <stdexcept>
 #include "../include/cli/cli.h"
+#include "../include/server/server.h"
+#include "../include/metrics/trace.h"
+
+namespace {
+
+toydb::server::Server* g_server = nullptr;
+
+void handle_signal(int) {
+    if (g_server) {
+        g_server->stop();
+    }
+}
+
+// Run in server mode:
+// toydb --serve [--host HOST] [--port PORT] [--socket PATH] [--trace FILE]
+int serve(int argc, char* argv[]) {
+    toydb::server::ServerOptions options;
+    std::string trace_path;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--host" && i + 1 < argc) {
+            options.host = argv[++i];
+        } else if (arg == "--port" && i + 1 < argc) {
+            options.port = static_cast<uint16_t>(std::stoi(argv[++i]));
+        } else if (arg == "--socket" && i + 1 < argc) {
+            options.unix_socket = argv[++i];
+        } else if (arg == "--trace" && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else {
+            std::cerr << "Unknown server option: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    auto db = std::make_shared<toydb::db::Database>("toydb");
+    toydb::server::Server server(db, options);
+
+    g_server = &server;
+    std::signal(SIGINT, handle_signal);
+    std::signal(SIGTERM, handle_signal);
+
+    server.run();
+
+    g_server = nullptr;
+    std::cout << "Server stopped." << std::endl;
+
+    // Spans are only recorded in TOYDB_TRACING builds
+    if (!trace_path.empty() && !toydb::metrics::write_chrome_trace(trace_path)) {
+        std::cerr << "Cannot write trace: " << trace_path << std::endl;
+    }
+    return 0;
+}
+
+} // namespace
 
 int main(int argc, char* argv[]) {
     try {
         std::cout << "Welcome to ToyDB - A simple C++ database with B+ Tree indexing\n"
                   << "---------------------------------------------------------------\n";
-                  
+
+        if (argc > 1 && std::strcmp(argv[1], "--serve") == 0) {
+            return serve(argc, argv);
+        }
+
         toydb::cli::CLI cli;
-        
+
         // If we have command-line arguments, execute each as a command
         if (argc > 1) {
             for (int i = 1; i < argc; ++i) {
@@ -19,7 +80,7 @@ int main(int argc, char* argv[]) {
             // Otherwise, start the interactive CLI
             cli.start();
         }
-        
+
         return 0;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
@@ -28,4 +89,4 @@ int main(int argc, char* argv[]) {
         std::cerr << "Unknown error occurred" << std::endl;
         return 1;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,204 @@
+#include "../../include/metrics/metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+namespace toydb {
+namespace metrics {
+
+std::atomic<uint32_t> g_sample_rate{1};
+
+size_t next_shard() {
+    static std::atomic<size_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+void set_sample_rate(uint32_t rate) {
+    g_sample_rate.store(rate, std::memory_order_relaxed);
+}
+
+uint32_t sample_rate() {
+    return g_sample_rate.load(std::memory_order_relaxed);
+}
+
+// Counter implementation
+uint64_t Counter::value() const {
+    uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void Counter::reset() {
+    for (auto& shard : shards_) {
+        shard.value.store(0, std::memory_order_relaxed);
+    }
+}
+
+// Histogram implementation
+size_t Histogram::bucket_index(uint64_t value) {
+    if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+
+    unsigned exponent = 63 - static_cast<unsigned>(__builtin_clzll(value));
+    if (exponent > kMaxExponent) {
+        return kBucketCount - 1;
+    }
+
+    // The bits below the leading one select the linear sub-bucket
+    uint64_t sub = (value >> (exponent - kSubBucketBits)) - kSubBuckets;
+    return kSubBuckets * (exponent - kSubBucketBits + 1) + static_cast<size_t>(sub);
+}
+
+uint64_t Histogram::bucket_upper_bound(size_t index) {
+    if (index < kSubBuckets) {
+        return index;
+    }
+
+    unsigned exponent = static_cast<unsigned>(index / kSubBuckets) + kSubBucketBits - 1;
+    uint64_t sub = index % kSubBuckets;
+    uint64_t lower = (kSubBuckets + sub) << (exponent - kSubBucketBits);
+    return lower + (uint64_t{1} << (exponent - kSubBucketBits)) - 1;
+}
+
+void Histogram::record(uint64_t value) {
+    Shard& shard = shards_[shard_index() % kHistogramShards];
+    shard.count.fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(value, std::memory_order_relaxed);
+    shard.buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t max = shard.max.load(std::memory_order_relaxed);
+    while (value > max &&
+           !shard.max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+HistogramSnapshot Histogram::snapshot() const {
+    HistogramSnapshot snapshot;
+    snapshot.buckets.assign(kBucketCount, 0);
+
+    for (const auto& shard : shards_) {
+        snapshot.count += shard.count.load(std::memory_order_relaxed);
+        snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+        snapshot.max = std::max(snapshot.max, shard.max.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            snapshot.buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+void Histogram::reset() {
+    for (auto& shard : shards_) {
+        shard.count.store(0, std::memory_order_relaxed);
+        shard.sum.store(0, std::memory_order_relaxed);
+        shard.max.store(0, std::memory_order_relaxed);
+        for (auto& bucket : shard.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+uint64_t HistogramSnapshot::percentile(double q) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(count)));
+    rank = std::min(std::max<uint64_t>(rank, 1), count);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return std::min(Histogram::bucket_upper_bound(i), max);
+        }
+    }
+    return max;
+}
+
+// Registry implementation
+Registry& Registry::instance() {
+    static Registry registry;
+    return registry;
+}
+
+Registry::Registry() {
+    if (const char* rate = std::getenv("TOYDB_METRICS_SAMPLE")) {
+        set_sample_rate(static_cast<uint32_t>(std::strtoul(rate, nullptr, 10)));
+    }
+}
+
+Counter& Registry::counter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = counters_[name];
+    if (!slot) {
+        slot = std::make_unique<Counter>();
+    }
+    return *slot;
+}
+
+Histogram& Registry::histogram(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = histograms_[name];
+    if (!slot) {
+        slot = std::make_unique<Histogram>();
+    }
+    return *slot;
+}
+
+namespace {
+
+std::string format_us(uint64_t ns) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1) << static_cast<double>(ns) / 1000.0 << "us";
+    return out.str();
+}
+
+} // namespace
+
+std::vector<std::pair<std::string, std::string>> Registry::rows() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::pair<std::string, std::string>> rows;
+
+    for (const auto& [name, counter] : counters_) {
+        rows.emplace_back(name, std::to_string(counter->value()));
+    }
+
+    for (const auto& [name, histogram] : histograms_) {
+        HistogramSnapshot s = histogram->snapshot();
+        rows.emplace_back(name,
+                          "count=" + std::to_string(s.count) +
+                          " mean=" + format_us(static_cast<uint64_t>(s.mean())) +
+                          " p50=" + format_us(s.percentile(0.50)) +
+                          " p99=" + format_us(s.percentile(0.99)) +
+                          " p999=" + format_us(s.percentile(0.999)) +
+                          " max=" + format_us(s.max));
+    }
+
+    std::sort(rows.begin(), rows.end());
+    return rows;
+}
+
+void Registry::dump(std::ostream& out) const {
+    for (const auto& [name, value] : rows()) {
+        out << name << " " << value << "\n";
+    }
+}
+
+void Registry::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [name, counter] : counters_) {
+        counter->reset();
+    }
+    for (auto& [name, histogram] : histograms_) {
+        histogram->reset();
+    }
+}
+
+} // namespace metrics
+} // namespace toydb
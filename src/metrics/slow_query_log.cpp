@@ -0,0 +1,184 @@
+#include "../../include/metrics/slow_query_log.h"
+#include <cctype>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace toydb {
+namespace metrics {
+
+namespace {
+
+bool is_identifier_char(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+double to_us(std::chrono::nanoseconds ns) {
+    return static_cast<double>(ns.count()) / 1000.0;
+}
+
+std::string format_time(std::chrono::system_clock::time_point time) {
+    std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(
+        time.time_since_epoch()).count() % 1000;
+
+    std::tm utc;
+    gmtime_r(&seconds, &utc);
+
+    std::ostringstream out;
+    out << std::put_time(&utc, "%Y-%m-%dT%H:%M:%S") << '.'
+        << std::setw(3) << std::setfill('0') << millis << 'Z';
+    return out.str();
+}
+
+} // namespace
+
+std::string normalize_sql(const std::string& sql) {
+    std::string out;
+    out.reserve(sql.size());
+
+    for (size_t i = 0; i < sql.size(); ++i) {
+        char c = sql[i];
+
+        if (c == '\'' || c == '"') {
+            // Quoted literal
+            size_t end = sql.find(c, i + 1);
+            i = end == std::string::npos ? sql.size() : end;
+            out += '?';
+        } else if (std::isdigit(static_cast<unsigned char>(c)) &&
+                   (out.empty() || !is_identifier_char(out.back()))) {
+            // Numeric literal (identifiers such as t1 are kept)
+            while (i + 1 < sql.size() &&
+                   (std::isdigit(static_cast<unsigned char>(sql[i + 1])) || sql[i + 1] == '.')) {
+                ++i;
+            }
+            // Fold a sign into the literal
+            if (!out.empty() && out.back() == '-') {
+                out.pop_back();
+            }
+            out += '?';
+        } else if (std::isspace(static_cast<unsigned char>(c))) {
+            if (!out.empty() && out.back() != ' ') {
+                out += ' ';
+            }
+        } else {
+            out += c;
+        }
+    }
+
+    while (!out.empty() && (out.back() == ' ' || out.back() == ';')) {
+        out.pop_back();
+    }
+    return out;
+}
+
+SlowQueryLog& SlowQueryLog::instance() {
+    static SlowQueryLog log;
+    static bool configured = [] {
+        const char* path = std::getenv("TOYDB_SLOW_QUERY_LOG");
+        if (path && *path) {
+            const char* ms = std::getenv("TOYDB_SLOW_QUERY_MS");
+            long threshold = ms ? std::strtol(ms, nullptr, 10) : 100;
+            if (!log.open(path, std::chrono::milliseconds(threshold))) {
+                std::cerr << "Cannot open slow query log: " << path << std::endl;
+            }
+        }
+        return true;
+    }();
+    (void)configured;
+    return log;
+}
+
+SlowQueryLog::~SlowQueryLog() {
+    close();
+}
+
+bool SlowQueryLog::open(const std::string& path, std::chrono::microseconds threshold) {
+    close();
+
+    file_.open(path, std::ios::app);
+    if (!file_) {
+        return false;
+    }
+
+    threshold_ = threshold;
+    stopping_ = false;
+    writer_ = std::thread(&SlowQueryLog::run_writer, this);
+    enabled_.store(true);
+    return true;
+}
+
+void SlowQueryLog::close() {
+    enabled_.store(false);
+
+    if (writer_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        writer_.join();
+    }
+
+    if (file_.is_open()) {
+        file_.close();
+    }
+}
+
+void SlowQueryLog::record(QueryProfile profile) {
+    if (!enabled() || profile.total < threshold_) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.size() >= kMaxQueued) {
+            dropped_++;
+            return;
+        }
+        queue_.emplace_back(std::chrono::system_clock::now(), std::move(profile));
+    }
+    cv_.notify_one();
+}
+
+uint64_t SlowQueryLog::dropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+}
+
+void SlowQueryLog::run_writer() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty() && stopping_) {
+            break;
+        }
+
+        // Format and write without holding the lock
+        auto batch = std::move(queue_);
+        queue_.clear();
+        lock.unlock();
+
+        for (const auto& [time, p] : batch) {
+            file_ << format_time(time) << std::fixed << std::setprecision(1)
+                  << " total_us=" << to_us(p.total)
+                  << " parse_us=" << to_us(p.parse)
+                  << " convert_us=" << to_us(p.convert)
+                  << " execute_us=" << to_us(p.execute)
+                  << " format_us=" << to_us(p.format)
+                  << " rows_examined=" << p.rows_examined
+                  << " rows_returned=" << p.rows_returned
+                  << " access_path=" << p.access_path
+                  << " query=\"" << normalize_sql(p.sql) << "\"\n";
+        }
+        file_.flush();
+
+        lock.lock();
+    }
+}
+
+} // namespace metrics
+} // namespace toydb
@@ -0,0 +1,100 @@
+#include "../../include/metrics/trace.h"
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace toydb {
+namespace metrics {
+
+namespace {
+
+// Buffers outlive their threads so spans of finished threads can be exported
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<TraceBuffer>> buffers;
+};
+
+TraceRegistry& trace_registry() {
+    static TraceRegistry registry;
+    return registry;
+}
+
+void write_json_string(std::ostream& out, const char* s) {
+    out << '"';
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\') {
+            out << '\\';
+        }
+        out << *s;
+    }
+    out << '"';
+}
+
+} // namespace
+
+uint64_t trace_now_ns() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - epoch).count());
+}
+
+TraceBuffer& thread_trace_buffer() {
+    thread_local std::shared_ptr<TraceBuffer> buffer = [] {
+        TraceRegistry& registry = trace_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto created = std::make_shared<TraceBuffer>(
+            static_cast<uint32_t>(registry.buffers.size() + 1));
+        registry.buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+void write_chrome_trace(std::ostream& out) {
+    TraceRegistry& registry = trace_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+
+    for (const auto& buffer : registry.buffers) {
+        uint64_t head = buffer->head();
+        uint64_t begin = head > TraceBuffer::kCapacity ? head - TraceBuffer::kCapacity : 0;
+
+        for (uint64_t i = begin; i < head; ++i) {
+            const TraceEvent& event = buffer->at(i);
+            out << (first ? "\n" : ",\n") << "{\"name\":";
+            write_json_string(out, event.name);
+            out << ",\"cat\":";
+            write_json_string(out, event.category);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id()
+                << std::fixed << std::setprecision(3)
+                << ",\"ts\":" << static_cast<double>(event.start_ns) / 1000.0
+                << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000.0 << "}";
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+}
+
+bool write_chrome_trace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    write_chrome_trace(out);
+    return static_cast<bool>(out);
+}
+
+void clear_trace() {
+    TraceRegistry& registry = trace_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& buffer : registry.buffers) {
+        buffer->clear();
+    }
+}
+
+} // namespace metrics
+} // namespace toydb
@@ -1,4 +1,6 @@
 #include "../../include/parser/parser.h"
+#include "../../include/metrics/metrics.h"
+#include "../../include/metrics/trace.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
@@ -9,8 +11,8 @@ namespace toydb {
 namespace parser {
 
 // Helper function to convert a string to uppercase
-std::string to_upper(const std::string& str) {
-    std::string result = str;
+std::string to_upper(std::string_view str) {
+    std::string result(str);
     std::transform(result.begin(), result.end(), result.begin(), ::toupper);
     return result;
 }
@@ -26,6 +28,23 @@ std::string trim(const std::string& str) {
 
 // Parse a SQL statement
 std::optional<Statement> Parser::parse(const std::string& sql) {
+    static metrics::Counter& parses = metrics::counter("parser.parse");
+    static metrics::Counter& errors = metrics::counter("parser.errors");
+    static metrics::Histogram& latency = metrics::histogram("parser.parse.latency");
+    
+    metrics::ScopedTimer timer(latency);
+    TOYDB_TRACE_SPAN("parse", "parser");
+    parses.add();
+    
+    auto statement = parse_statement(sql);
+    scratch_.release();
+    if (!statement) {
+        errors.add();
+    }
+    return statement;
+}
+
+std::optional<Statement> Parser::parse_statement(const std::string& sql) {
     error_.clear();
     
     // Tokenize the SQL statement
@@ -41,8 +60,9 @@ std::optional<Statement> Parser::parse(const std::string& sql) {
     if (cmd == "CREATE") {
         if (tokens.size() > 1 && to_upper(tokens[1]) == "TABLE") {
             return parse_create_table(tokens);
-        } else if (tokens.size() > 1 && to_upper(tokens[1]) == "INDEX") {
-            return parse_create_index();
+        }
+        if (tokens.size() > 1 && to_upper(tokens[1]) == "INDEX") {
+            return parse_create_index(tokens);
         }
     } else if (cmd == "INSERT") {
         return parse_insert(tokens);
@@ -55,16 +75,17 @@ std::optional<Statement> Parser::parse(const std::string& sql) {
     } else if (cmd == "DROP") {
         if (tokens.size() > 1 && to_upper(tokens[1]) == "TABLE") {
             return parse_drop_table(tokens);
-        } else if (tokens.size() > 1 && to_upper(tokens[1]) == "INDEX") {
-            return parse_drop_index();
         }
     } else if (cmd == "SHOW") {
         if (tokens.size() > 1 && to_upper(tokens[1]) == "TABLES") {
             return parse_show_tables(tokens);
         }
-    } else if (cmd == "ALTER") {
-        if (tokens.size() > 1 && to_upper(tokens[1]) == "TABLE") {
-            return parse_alter_table();
+        if (tokens.size() > 1 && to_upper(tokens[1]) == "METRICS") {
+            return parse_show_metrics(tokens);
+        }
+        if (tokens.size() > 2 && to_upper(tokens[1]) == "TABLE" &&
+            to_upper(tokens[2]) == "STATUS") {
+            return parse_show_table_status(tokens);
         }
     } else if (cmd == "BEGIN") {
         if (tokens.size() > 1 && to_upper(tokens[1]) == "TRANSACTION") {
@@ -85,81 +106,81 @@ std::optional<Statement> Parser::parse(const std::string& sql) {
 }
 
 // Tokenize SQL string into individual tokens
-std::vector<std::string> Parser::tokenize(const std::string& sql) {
-    std::vector<std::string> tokens;
-    std::string current_token;
+TokenList Parser::tokenize(const std::string& sql) {
+    TokenList tokens(scratch_.resource());
+    std::string_view text(sql);
+    size_t token_start = 0;     // Start of the token being accumulated
+    size_t token_length = 0;
     bool in_quotes = false;
     char quote_char = '\0';
     
-    for (size_t i = 0; i < sql.length(); ++i) {
-        char c = sql[i];
+    auto flush = [&] {
+        if (token_length > 0) {
+            tokens.push_back(text.substr(token_start, token_length));
+            token_length = 0;
+        }
+    };
+    auto extend = [&](size_t i) {
+        if (token_length == 0) {
+            token_start = i;
+        }
+        token_length++;
+    };
+    
+    for (size_t i = 0; i < text.length(); ++i) {
+        char c = text[i];
         
         if (c == '\'' || c == '\"') {
             if (!in_quotes) {
                 // Start of quoted string
-                if (!current_token.empty()) {
-                    tokens.push_back(current_token);
-                    current_token.clear();
-                }
+                flush();
                 in_quotes = true;
                 quote_char = c;
-                current_token += c;
+                extend(i);
             } else if (c == quote_char) {
                 // End of quoted string
-                current_token += c;
-                tokens.push_back(current_token);
-                current_token.clear();
+                extend(i);
+                flush();
                 in_quotes = false;
             } else {
                 // Quote character inside another type of quotes
-                current_token += c;
+                extend(i);
             }
         } else if (in_quotes) {
             // Inside quotes, add character as is
-            current_token += c;
-        } else if (std::isspace(c)) {
+            extend(i);
+        } else if (std::isspace(static_cast<unsigned char>(c))) {
             // Whitespace, end current token
-            if (!current_token.empty()) {
-                tokens.push_back(current_token);
-                current_token.clear();
-            }
+            flush();
         } else if (c == ',' || c == '(' || c == ')' || c == ';') {
             // Special characters that are tokens on their own
-            if (!current_token.empty()) {
-                tokens.push_back(current_token);
-                current_token.clear();
-            }
-            tokens.push_back(std::string(1, c));
+            flush();
+            tokens.push_back(text.substr(i, 1));
         } else if (c == '=' || c == '<' || c == '>' || c == '!') {
             // Operators
-            if (!current_token.empty()) {
-                tokens.push_back(current_token);
-                current_token.clear();
-            }
+            flush();
             
             // Check for two-character operators
-            if (i + 1 < sql.length() && (sql[i + 1] == '=' || (c == '<' && sql[i + 1] == '>'))) {
-                tokens.push_back(sql.substr(i, 2));
+            if (i + 1 < text.length() && (text[i + 1] == '=' || (c == '<' && text[i + 1] == '>'))) {
+                tokens.push_back(text.substr(i, 2));
                 i++; // Skip next character
             } else {
-                tokens.push_back(std::string(1, c));
+                tokens.push_back(text.substr(i, 1));
             }
         } else {
             // Normal character, add to current token
-            current_token += c;
+            extend(i);
         }
     }
     
     // Add the last token if there is one
-    if (!current_token.empty()) {
-        tokens.push_back(current_token);
-    }
+    flush();
     
     return tokens;
 }
 
 // Parse CREATE TABLE statement
-std::optional<CreateTableStmt> Parser::parse_create_table(std::vector<std::string>& tokens) {
+std::optional<CreateTableStmt> Parser::parse_create_table(TokenList& tokens) {
     // Ensure we have enough tokens
     if (tokens.size() < 4) {
         error_ = "Invalid CREATE TABLE syntax";
@@ -170,7 +191,7 @@ std::optional<CreateTableStmt> Parser::parse_create_table(std::vector<std::strin
     tokens.erase(tokens.begin(), tokens.begin() + 2);
     
     // Get table name
-    std::string table_name = tokens[0];
+    std::string table_name(tokens[0]);
     tokens.erase(tokens.begin());
     
     // Expect opening parenthesis
@@ -198,7 +219,7 @@ std::optional<CreateTableStmt> Parser::parse_create_table(std::vector<std::strin
             return std::nullopt;
         }
         
-        std::string col_name = tokens[0];
+        std::string col_name(tokens[0]);
         tokens.erase(tokens.begin());
         
         // Parse column type
@@ -243,6 +264,25 @@ std::optional<CreateTableStmt> Parser::parse_create_table(std::vector<std::strin
         }
     }
     
+    // Optional storage engine: ENGINE [=] name
+    std::string engine = "HEAP";
+    if (!tokens.empty() && to_upper(tokens[0]) == "ENGINE") {
+        tokens.erase(tokens.begin());
+        if (!tokens.empty() && tokens[0] == "=") {
+            tokens.erase(tokens.begin());
+        }
+        if (tokens.empty() || tokens[0] == ";") {
+            error_ = "Expected storage engine after ENGINE";
+            return std::nullopt;
+        }
+        engine = to_upper(tokens[0]);
+        tokens.erase(tokens.begin());
+        if (engine != "HEAP" && engine != "LSM") {
+            error_ = "Unknown storage engine: " + engine;
+            return std::nullopt;
+        }
+    }
+    
     // Check for semicolon at the end
     if (!tokens.empty() && tokens[0] == ";") {
         tokens.erase(tokens.begin());
@@ -256,11 +296,111 @@ std::optional<CreateTableStmt> Parser::parse_create_table(std::vector<std::strin
     CreateTableStmt stmt;
     stmt.table_name = table_name;
     stmt.columns = columns;
+    stmt.engine = engine;
+    return stmt;
+}
+
+// Parse CREATE INDEX statement:
+// CREATE INDEX name ON table [USING method] (col, ...) [USING method]
+//     [INCLUDE (col, ...)] [USING method] [WHERE conditions]
+std::optional<CreateIndexStmt> Parser::parse_create_index(TokenList& tokens) {
+    // Ensure we have enough tokens
+    if (tokens.size() < 7) {
+        error_ = "Invalid CREATE INDEX syntax";
+        return std::nullopt;
+    }
+    
+    // Skip "CREATE INDEX" part
+    tokens.erase(tokens.begin(), tokens.begin() + 2);
+    
+    CreateIndexStmt stmt;
+    stmt.index_name = tokens[0];
+    tokens.erase(tokens.begin());
+    
+    if (to_upper(tokens[0]) != "ON") {
+        error_ = "Expected ON after index name";
+        return std::nullopt;
+    }
+    tokens.erase(tokens.begin());
+    
+    stmt.table_name = tokens[0];
+    tokens.erase(tokens.begin());
+    
+    auto parse_using = [&]() {
+        if (tokens.size() < 2 || to_upper(tokens[0]) != "USING") {
+            return true;
+        }
+        stmt.method = to_upper(tokens[1]);
+        tokens.erase(tokens.begin(), tokens.begin() + 2);
+        if (stmt.method != "BTREE" && stmt.method != "HASH" && stmt.method != "ART" &&
+            stmt.method != "BITMAP") {
+            error_ = "Unknown index method: " + stmt.method;
+            return false;
+        }
+        return true;
+    };
+    
+    if (!parse_using()) {
+        return std::nullopt;
+    }
+    
+    // Parse a parenthesised column list into columns
+    auto parse_columns = [&](std::vector<std::string>& columns, const std::string& what) {
+        if (tokens.empty() || tokens[0] != "(") {
+            error_ = "Expected '(' before " + what;
+            return false;
+        }
+        tokens.erase(tokens.begin());
+        
+        while (!tokens.empty() && tokens[0] != ")") {
+            columns.emplace_back(tokens[0]);
+            tokens.erase(tokens.begin());
+            
+            if (!tokens.empty() && tokens[0] == ",") {
+                tokens.erase(tokens.begin());
+            } else if (!tokens.empty() && tokens[0] != ")") {
+                error_ = "Expected ',' or ')' after column name";
+                return false;
+            }
+        }
+        
+        if (tokens.empty() || columns.empty()) {
+            error_ = "Expected column list for " + what;
+            return false;
+        }
+        tokens.erase(tokens.begin());
+        return true;
+    };
+    
+    if (!parse_columns(stmt.columns, "index columns") || !parse_using()) {
+        return std::nullopt;
+    }
+    
+    if (!tokens.empty() && to_upper(tokens[0]) == "INCLUDE") {
+        tokens.erase(tokens.begin());
+        if (!parse_columns(stmt.include, "INCLUDE columns") || !parse_using()) {
+            return std::nullopt;
+        }
+    }
+    
+    // Partial index predicate
+    if (!tokens.empty() && to_upper(tokens[0]) == "WHERE") {
+        stmt.conditions = parse_conditions(tokens);
+        if (stmt.conditions.empty()) {
+            return std::nullopt;
+        }
+    }
+    
+    // Check for semicolon
+    if (!tokens.empty() && tokens[0] == ";") {
+        tokens.erase(tokens.begin());
+    }
+    
     return stmt;
 }
 
 // Parse INSERT statement
-std::optional<InsertStmt> Parser::parse_insert(std::vector<std::string>& tokens) {
+std::optional<InsertStmt> Parser::parse_insert(TokenList& tokens) {
     // Ensure we have enough tokens
     if (tokens.size() < 4) {
         error_ = "Invalid INSERT syntax";
@@ -283,7 +423,7 @@ std::optional<InsertStmt> Parser::parse_insert(std::vector<std::string>& tokens)
         return std::nullopt;
     }
     
-    std::string table_name = tokens[0];
+    std::string table_name(tokens[0]);
     tokens.erase(tokens.begin());
     
     InsertStmt stmt;
@@ -295,7 +435,7 @@ std::optional<InsertStmt> Parser::parse_insert(std::vector<std::string>& tokens)
         
         // Parse column names
         while (!tokens.empty() && tokens[0] != ")") {
-            stmt.columns.push_back(tokens[0]);
+            stmt.columns.emplace_back(tokens[0]);
             tokens.erase(tokens.begin());
             
             if (!tokens.empty() && tokens[0] == ",") {
@@ -328,7 +468,7 @@ std::optional<InsertStmt> Parser::parse_insert(std::vector<std::string>& tokens)
         
         // Parse value list
         while (!tokens.empty() && tokens[0] != ")") {
-            row_values.push_back(tokens[0]);
+            row_values.emplace_back(tokens[0]);
             tokens.erase(tokens.begin());
             
             if (!tokens.empty() && tokens[0] == ",") {
@@ -364,7 +504,7 @@ std::optional<InsertStmt> Parser::parse_insert(std::vector<std::string>& tokens)
 }
 
 // Parse WHERE conditions
-std::vector<Condition> Parser::parse_conditions(std::vector<std::string>& tokens) {
+std::vector<Condition> Parser::parse_conditions(TokenList& tokens) {
     std::vector<Condition> conditions;
     
     if (tokens.empty()) {
@@ -377,37 +517,133 @@ std::vector<Condition> Parser::parse_conditions(std::vector<std::string>& tokens
     }
     tokens.erase(tokens.begin());
     
-    while (!tokens.empty()) {
-        if (tokens.size() < 3) {
-            error_ = "Invalid WHERE clause syntax";
-            return {};
+    if (!parse_disjunction(tokens, conditions)) {
+        return {};
+    }
+    
+    // The WHERE clause ends the statement
+    if (!tokens.empty() && !(tokens.size() == 1 && tokens[0] == ";")) {
+        error_ = "Unexpected '" + std::string(tokens[0]) + "' in WHERE clause";
+        return {};
+    }
+    return conditions;
+}
+
+// conjunction [OR conjunction ...]; several branches become one OR condition
+bool Parser::parse_disjunction(TokenList& tokens, std::vector<Condition>& out) {
+    std::vector<std::vector<Condition>> branches(1);
+    if (!parse_conjunction(tokens, branches.back())) {
+        return false;
+    }
+    while (!tokens.empty() && to_upper(tokens[0]) == "OR") {
+        tokens.erase(tokens.begin());
+        branches.emplace_back();
+        if (!parse_conjunction(tokens, branches.back())) {
+            return false;
         }
-        
+    }
+    
+    if (branches.size() == 1) {
+        out.insert(out.end(), branches[0].begin(), branches[0].end());
+    } else {
         Condition cond;
-        cond.column = tokens[0];
+        cond.op = "OR";
+        cond.any_of = std::move(branches);
+        out.push_back(std::move(cond));
+    }
+    return true;
+}
+
+// predicate [AND predicate ...]
+bool Parser::parse_conjunction(TokenList& tokens, std::vector<Condition>& out) {
+    if (!parse_predicate(tokens, out)) {
+        return false;
+    }
+    while (!tokens.empty() && to_upper(tokens[0]) == "AND") {
         tokens.erase(tokens.begin());
-        
-        cond.op = tokens[0];
+        if (!parse_predicate(tokens, out)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// column op value | column IN (value, ...) | (disjunction)
+bool Parser::parse_predicate(TokenList& tokens, std::vector<Condition>& out) {
+    if (!tokens.empty() && tokens[0] == "(") {
+        tokens.erase(tokens.begin());
+        if (!parse_disjunction(tokens, out)) {
+            return false;
+        }
+        if (tokens.empty() || tokens[0] != ")") {
+            error_ = "Expected ')' in WHERE clause";
+            return false;
+        }
+        tokens.erase(tokens.begin());
+        return true;
+    }
+    
+    if (tokens.size() < 3) {
+        error_ = "Invalid WHERE clause syntax";
+        return false;
+    }
+    
+    Condition cond;
+    cond.column = tokens[0];
+    tokens.erase(tokens.begin());
+    
+    if (to_upper(tokens[0]) != "IN") {
+        cond.op = tokens[0] == "<>" ? "!=" : std::string(tokens[0]);
+        if (cond.op != "=" && cond.op != "!=" && cond.op != "<" && cond.op != ">" &&
+            cond.op != "<=" && cond.op != ">=") {
+            error_ = "Unknown operator in WHERE clause: " + std::string(tokens[0]);
+            return false;
+        }
         tokens.erase(tokens.begin());
         
+        if (tokens[0] == "(" || tokens[0] == ")" || tokens[0] == "," || tokens[0] == ";") {
+            error_ = "Expected value after '" + cond.op + "' in WHERE clause";
+            return false;
+        }
         cond.value = tokens[0];
         tokens.erase(tokens.begin());
         
-        conditions.push_back(cond);
+        out.push_back(std::move(cond));
+        return true;
+    }
+    
+    cond.op = "IN";
+    tokens.erase(tokens.begin());
+    if (tokens[0] != "(") {
+        error_ = "Expected '(' after IN";
+        return false;
+    }
+    tokens.erase(tokens.begin());
+    
+    while (!tokens.empty() && tokens[0] != ")") {
+        cond.values.emplace_back(tokens[0]);
+        tokens.erase(tokens.begin());
         
-        // Check for AND to continue conditions
-        if (!tokens.empty() && to_upper(tokens[0]) == "AND") {
+        if (!tokens.empty() && tokens[0] == ",") {
             tokens.erase(tokens.begin());
-        } else {
-            break;
+        } else if (!tokens.empty() && tokens[0] != ")") {
+            error_ = "Expected ',' or ')' in IN list";
+            return false;
         }
     }
     
-    return conditions;
+    if (tokens.empty() || cond.values.empty()) {
+        error_ = "Expected value list for IN";
+        return false;
+    }
+    tokens.erase(tokens.begin());
+    
+    out.push_back(std::move(cond));
+    return true;
 }
 
 // Parse SELECT statement
-std::optional<SelectStmt> Parser::parse_select(std::vector<std::string>& tokens) {
+std::optional<SelectStmt> Parser::parse_select(TokenList& tokens) {
     // Ensure we have enough tokens
     if (tokens.size() < 4) {
         error_ = "Invalid SELECT syntax";
@@ -427,7 +663,7 @@ std::optional<SelectStmt> Parser::parse_select(std::vector<std::string>& tokens)
             break;
         }
         
-        stmt.columns.push_back(tokens[0]);
+        stmt.columns.emplace_back(tokens[0]);
         tokens.erase(tokens.begin());
         
         if (!tokens.empty() && tokens[0] == ",") {
@@ -456,6 +692,9 @@ std::optional<SelectStmt> Parser::parse_select(std::vector<std::string>& tokens)
     // Parse WHERE conditions if present
     if (!tokens.empty() && to_upper(tokens[0]) == "WHERE") {
         stmt.conditions = parse_conditions(tokens);
+        if (stmt.conditions.empty()) {
+            return std::nullopt;
+        }
     }
     
     // Check for semicolon
@@ -467,7 +706,7 @@ std::optional<SelectStmt> Parser::parse_select(std::vector<std::string>& tokens)
 }
 
 // Parse UPDATE statement
-std::optional<UpdateStmt> Parser::parse_update(std::vector<std::string>& tokens) {
+std::optional<UpdateStmt> Parser::parse_update(TokenList& tokens) {
     // Ensure we have enough tokens
     if (tokens.size() < 5) {
         error_ = "Invalid UPDATE syntax";
@@ -501,7 +740,7 @@ std::optional<UpdateStmt> Parser::parse_update(std::vector<std::string>& tokens)
             return std::nullopt;
         }
         
-        std::string column = tokens[0];
+        std::string column(tokens[0]);
         tokens.erase(tokens.begin());
         
         if (tokens.empty() || tokens[0] != "=") {
@@ -510,7 +749,7 @@ std::optional<UpdateStmt> Parser::parse_update(std::vector<std::string>& tokens)
         }
         tokens.erase(tokens.begin());
         
-        std::string value = tokens[0];
+        std::string value(tokens[0]);
         tokens.erase(tokens.begin());
         
         stmt.updates.emplace_back(column, value);
@@ -526,6 +765,9 @@ std::optional<UpdateStmt> Parser::parse_update(std::vector<std::string>& tokens)
     // Parse WHERE conditions if present
     if (!tokens.empty() && to_upper(tokens[0]) == "WHERE") {
         stmt.conditions = parse_conditions(tokens);
+        if (stmt.conditions.empty()) {
+            return std::nullopt;
+        }
     }
     
     // Check for semicolon
@@ -537,7 +779,7 @@ std::optional<UpdateStmt> Parser::parse_update(std::vector<std::string>& tokens)
 }
 
 // Parse DELETE statement
-std::optional<DeleteStmt> Parser::parse_delete(std::vector<std::string>& tokens) {
+std::optional<DeleteStmt> Parser::parse_delete(TokenList& tokens) {
     // Ensure we have enough tokens
     if (tokens.size() < 4) {
         error_ = "Invalid DELETE syntax";
@@ -567,6 +809,9 @@ std::optional<DeleteStmt> Parser::parse_delete(std::vector<std::string>& tokens)
     // Parse WHERE conditions if present
     if (!tokens.empty() && to_upper(tokens[0]) == "WHERE") {
         stmt.conditions = parse_conditions(tokens);
+        if (stmt.conditions.empty()) {
+            return std::nullopt;
+        }
     }
     
     // Check for semicolon
@@ -578,7 +823,7 @@ std::optional<DeleteStmt> Parser::parse_delete(std::vector<std::string>& tokens)
 }
 
 // Parse DROP TABLE statement
-std::optional<DropTableStmt> Parser::parse_drop_table(std::vector<std::string>& tokens) {
+std::optional<DropTableStmt> Parser::parse_drop_table(TokenList& tokens) {
     // Ensure we have enough tokens
     if (tokens.size() < 3) {
         error_ = "Invalid DROP TABLE syntax";
@@ -607,7 +852,7 @@ std::optional<DropTableStmt> Parser::parse_drop_table(std::vector<std::string>&
 }
 
 // Parse SHOW TABLES statement
-std::optional<ShowTablesStmt> Parser::parse_show_tables(std::vector<std::string>& tokens) {
+std::optional<ShowTablesStmt> Parser::parse_show_tables(TokenList& tokens) {
     // Ensure we have enough tokens
     if (tokens.size() < 2) {
         error_ = "Invalid SHOW TABLES syntax";
@@ -625,6 +870,32 @@ std::optional<ShowTablesStmt> Parser::parse_show_tables(std::vector<std::string>
     return ShowTablesStmt{};
 }
 
+// Parse SHOW METRICS statement
+std::optional<ShowMetricsStmt> Parser::parse_show_metrics(TokenList& tokens) {
+    // Skip "SHOW METRICS" part
+    tokens.erase(tokens.begin(), tokens.begin() + 2);
+    
+    // Check for semicolon
+    if (!tokens.empty() && tokens[0] == ";") {
+        tokens.erase(tokens.begin());
+    }
+    
+    return ShowMetricsStmt{};
+}
+
+// Parse SHOW TABLE STATUS statement
+std::optional<ShowTableStatusStmt> Parser::parse_show_table_status(TokenList& tokens) {
+    // Skip "SHOW TABLE STATUS" part
+    tokens.erase(tokens.begin(), tokens.begin() + 3);
+    
+    // Check for semicolon
+    if (!tokens.empty() && tokens[0] == ";") {
+        tokens.erase(tokens.begin());
+    }
+    
+    return ShowTableStatusStmt{};
+}
+
 // Convert string type to ColumnType enum
 db::ColumnType string_to_column_type(const std::string& type_str) {
     std::string upper_type = to_upper(type_str);
@@ -651,6 +922,33 @@ db::ColumnDef convert_column_def(const ColumnDefinition& col_def) {
     return db_col;
 }
 
+// Convert parser index definition to DB index definition
+db::IndexDef convert_index_def(const CreateIndexStmt& stmt,
+                               const std::vector<db::ColumnDef>& columns) {
+    db::IndexDef def;
+    def.name = stmt.index_name;
+    def.columns = stmt.columns;
+    def.include = stmt.include;
+    for (const auto& cond : stmt.conditions) {
+        def.where.push_back(convert_condition(cond, columns));
+    }
+    if (stmt.method == "HASH") {
+        def.type = db::IndexType::Hash;
+    } else if (stmt.method == "ART") {
+        def.type = db::IndexType::Art;
+    } else if (stmt.method == "BITMAP") {
+        def.type = db::IndexType::Bitmap;
+    } else {
+        def.type = db::IndexType::BTree;
+    }
+    return def;
+}
+
+// Convert a CREATE TABLE engine name to the DB storage engine
+db::StorageEngine convert_storage_engine(const CreateTableStmt& stmt) {
+    return stmt.engine == "LSM" ? db::StorageEngine::Lsm : db::StorageEngine::Heap;
+}
+
 // Parse a string value to DBValue
 db::DBValue parse_value(const std::string& value_str, db::ColumnType expected_type) {
     // Check for NULL
@@ -695,6 +993,16 @@ db::Condition convert_condition(const Condition& cond, const std::vector<db::Col
     db_cond.column_name = cond.column;
     db_cond.op = cond.op;
     
+    if (cond.op == "OR") {
+        for (const auto& branch : cond.any_of) {
+            db::Conditions& converted = db_cond.any_of.emplace_back();
+            for (const auto& c : branch) {
+                converted.push_back(convert_condition(c, columns));
+            }
+        }
+        return db_cond;
+    }
+    
     // Find the column type
     db::ColumnType col_type = db::ColumnType::Text; // Default
     for (const auto& col : columns) {
@@ -704,91 +1012,61 @@ db::Condition convert_condition(const Condition& cond, const std::vector<db::Col
         }
     }
     
+    if (cond.op == "IN") {
+        for (const auto& value : cond.values) {
+            db_cond.values.push_back(parse_value(value, col_type));
+        }
+        return db_cond;
+    }
+    
     db_cond.value = parse_value(cond.value, col_type);
     return db_cond;
 }
 
-std::unique_ptr<Statement> Parser::parse_alter_table() {
-    auto stmt = std::make_unique<AlterTableStmt>();
-    
-    // Parse table name
-    stmt->table_name = parse_identifier();
-    
-    // Parse ALTER command
-    std::string command = parse_keyword();
-    if (command == "ADD") {
-        stmt->command = AlterTableStmt::Command::ADD;
-        if (parse_keyword() == "COLUMN") {
-            stmt->column_def = parse_column_def();
-        } else {
-            throw std::runtime_error("Expected COLUMN keyword after ADD");
-        }
-    } else if (command == "DROP") {
-        stmt->command = AlterTableStmt::Command::DROP;
-        if (parse_keyword() == "COLUMN") {
-            stmt->column_name = parse_identifier();
-        } else {
-            throw std::runtime_error("Expected COLUMN keyword after DROP");
+// Convert INSERT value strings to a DB row
+db::Row convert_row(const std::vector<std::string>& value_strs,
+                    const std::vector<db::ColumnDef>& columns,
+                    const std::vector<std::string>& col_names) {
+    db::Row row;
+    
+    // If column names are specified, map values to the correct columns
+    if (!col_names.empty()) {
+        // Initialize all columns to NULL
+        row.resize(columns.size(), db::DBNull{});
+        
+        if (value_strs.size() != col_names.size()) {
+            throw std::runtime_error("Column count mismatch");
         }
-    } else if (command == "RENAME") {
-        stmt->command = AlterTableStmt::Command::RENAME;
-        if (parse_keyword() == "TO") {
-            stmt->new_name = parse_identifier();
-        } else {
-            throw std::runtime_error("Expected TO keyword after RENAME");
+        
+        for (size_t i = 0; i < col_names.size(); ++i) {
+            // Find column index
+            size_t col_idx = std::find_if(columns.begin(), columns.end(), 
+                                        [&](const db::ColumnDef& col) { 
+                                            return col.name == col_names[i]; 
+                                        }) - columns.begin();
+            
+            if (col_idx >= columns.size()) {
+                throw std::runtime_error("Column not found: " + col_names[i]);
+            }
+            
+            row[col_idx] = parse_value(value_strs[i], columns[col_idx].type);
         }
     } else {
-        throw std::runtime_error("Invalid ALTER TABLE command");
-    }
-    
-    return stmt;
-}
-
-std::unique_ptr<Statement> Parser::parse_create_index() {
-    auto stmt = std::make_unique<CreateIndexStmt>();
-    
-    // Parse index name
-    stmt->index_name = parse_identifier();
-    
-    // Parse ON keyword
-    if (parse_keyword() != "ON") {
-        throw std::runtime_error("Expected ON keyword after index name");
-    }
-    
-    // Parse table name
-    stmt->table_name = parse_identifier();
-    
-    // Parse column list
-    if (parse_keyword() != "(") {
-        throw std::runtime_error("Expected ( after table name");
-    }
-    
-    do {
-        stmt->columns.push_back(parse_identifier());
-    } while (parse_keyword() == ",");
-    
-    return stmt;
-}
-
-std::unique_ptr<Statement> Parser::parse_drop_index() {
-    auto stmt = std::make_unique<DropIndexStmt>();
-    
-    // Parse index name
-    stmt->index_name = parse_identifier();
-    
-    // Parse ON keyword
-    if (parse_keyword() != "ON") {
-        throw std::runtime_error("Expected ON keyword after index name");
+        // Use values in order
+        if (value_strs.size() != columns.size()) {
+            throw std::runtime_error("Column count mismatch");
+        }
+        
+        for (size_t i = 0; i < columns.size(); ++i) {
+            row.push_back(parse_value(value_strs[i], columns[i].type));
+        }
     }
     
-    // Parse table name
-    stmt->table_name = parse_identifier();
-    
-    return stmt;
+    return row;
 }
 
 // Parse BEGIN TRANSACTION statement
-std::optional<BeginTransactionStmt> Parser::parse_begin_transaction(std::vector<std::string>& tokens) {
+std::optional<BeginTransactionStmt> Parser::parse_begin_transaction(TokenList& tokens) {
     // Verify syntax: BEGIN TRANSACTION
     if (tokens.size() < 2 || to_upper(tokens[0]) != "BEGIN" || to_upper(tokens[1]) != "TRANSACTION") {
         error_ = "Invalid BEGIN TRANSACTION syntax";
@@ -800,7 +1078,7 @@ std::optional<BeginTransactionStmt> Parser::parse_begin_transaction(std::vector<
 }
 
 // Parse COMMIT TRANSACTION statement
-std::optional<CommitTransactionStmt> Parser::parse_commit_transaction(std::vector<std::string>& tokens) {
+std::optional<CommitTransactionStmt> Parser::parse_commit_transaction(TokenList& tokens) {
     // Verify syntax: COMMIT TRANSACTION <transaction_id>
     if (tokens.size() < 3 || to_upper(tokens[0]) != "COMMIT" || to_upper(tokens[1]) != "TRANSACTION") {
         error_ = "Invalid COMMIT TRANSACTION syntax";
@@ -809,16 +1087,16 @@ std::optional<CommitTransactionStmt> Parser::parse_commit_transaction(std::vecto
     
     // Parse transaction ID
     try {
-        uint64_t transaction_id = std::stoull(tokens[2]);
+        uint64_t transaction_id = std::stoull(std::string(tokens[2]));
         return CommitTransactionStmt{transaction_id};
     } catch (const std::exception& e) {
-        error_ = "Invalid transaction ID: " + tokens[2];
+        error_ = "Invalid transaction ID: " + std::string(tokens[2]);
         return std::nullopt;
     }
 }
 
 // Parse ABORT/ROLLBACK TRANSACTION statement
-std::optional<AbortTransactionStmt> Parser::parse_abort_transaction(std::vector<std::string>& tokens) {
+std::optional<AbortTransactionStmt> Parser::parse_abort_transaction(TokenList& tokens) {
     // Verify syntax: ABORT/ROLLBACK TRANSACTION <transaction_id>
     if (tokens.size() < 3 || 
         (to_upper(tokens[0]) != "ABORT" && to_upper(tokens[0]) != "ROLLBACK") || 
@@ -829,10 +1107,10 @@ std::optional<AbortTransactionStmt> Parser::parse_abort_transaction(std::vector<
     
     // Parse transaction ID
     try {
-        uint64_t transaction_id = std::stoull(tokens[2]);
+        uint64_t transaction_id = std::stoull(std::string(tokens[2]));
         return AbortTransactionStmt{transaction_id};
     } catch (const std::exception& e) {
-        error_ = "Invalid transaction ID: " + tokens[2];
+        error_ = "Invalid transaction ID: " + std::string(tokens[2]);
         return std::nullopt;
     }
 }
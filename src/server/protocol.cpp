@@ -0,0 +1,210 @@
+#include "../../include/server/protocol.h"
+#include <cstring>
+
+namespace toydb {
+namespace server {
+
+// Encoder implementation
+void Encoder::put_u8(uint8_t v) {
+    out_.push_back(static_cast<char>(v));
+}
+
+void Encoder::put_u16(uint16_t v) {
+    out_.push_back(static_cast<char>(v >> 8));
+    out_.push_back(static_cast<char>(v));
+}
+
+void Encoder::put_u32(uint32_t v) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out_.push_back(static_cast<char>(v >> shift));
+    }
+}
+
+void Encoder::put_u64(uint64_t v) {
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        out_.push_back(static_cast<char>(v >> shift));
+    }
+}
+
+void Encoder::put_string(const std::string& s) {
+    put_u32(static_cast<uint32_t>(s.size()));
+    out_.append(s);
+}
+
+void Encoder::put_value(const db::DBValue& value) {
+    if (std::holds_alternative<db::DBInt>(value)) {
+        put_u8(static_cast<uint8_t>(ValueTag::Int));
+        put_u64(static_cast<uint64_t>(std::get<db::DBInt>(value)));
+    } else if (std::holds_alternative<db::DBFloat>(value)) {
+        uint64_t bits;
+        double d = std::get<db::DBFloat>(value);
+        std::memcpy(&bits, &d, sizeof(bits));
+        put_u8(static_cast<uint8_t>(ValueTag::Float));
+        put_u64(bits);
+    } else if (std::holds_alternative<db::DBText>(value)) {
+        put_u8(static_cast<uint8_t>(ValueTag::Text));
+        put_string(std::get<db::DBText>(value));
+    } else {
+        put_u8(static_cast<uint8_t>(ValueTag::Null));
+    }
+}
+
+size_t Encoder::begin_frame(uint8_t type) {
+    size_t start = out_.size();
+    put_u32(0); // Patched by end_frame
+    put_u8(type);
+    return start;
+}
+
+void Encoder::end_frame(size_t frame_start) {
+    uint32_t length = static_cast<uint32_t>(out_.size() - frame_start - 4);
+    for (int i = 0; i < 4; ++i) {
+        out_[frame_start + i] = static_cast<char>(length >> (24 - 8 * i));
+    }
+}
+
+// Decoder implementation
+bool Decoder::get_u8(uint8_t& v) {
+    if (remaining() < 1) return false;
+    v = static_cast<uint8_t>(data_[pos_++]);
+    return true;
+}
+
+bool Decoder::get_u16(uint16_t& v) {
+    if (remaining() < 2) return false;
+    v = static_cast<uint16_t>((static_cast<uint8_t>(data_[pos_]) << 8) |
+                              static_cast<uint8_t>(data_[pos_ + 1]));
+    pos_ += 2;
+    return true;
+}
+
+bool Decoder::get_u32(uint32_t& v) {
+    if (remaining() < 4) return false;
+    v = 0;
+    for (int i = 0; i < 4; ++i) {
+        v = (v << 8) | static_cast<uint8_t>(data_[pos_++]);
+    }
+    return true;
+}
+
+bool Decoder::get_u64(uint64_t& v) {
+    if (remaining() < 8) return false;
+    v = 0;
+    for (int i = 0; i < 8; ++i) {
+        v = (v << 8) | static_cast<uint8_t>(data_[pos_++]);
+    }
+    return true;
+}
+
+bool Decoder::get_string(std::string& s) {
+    uint32_t length;
+    if (!get_u32(length) || remaining() < length) return false;
+    s.assign(data_ + pos_, length);
+    pos_ += length;
+    return true;
+}
+
+bool Decoder::get_value(db::DBValue& value) {
+    uint8_t tag;
+    if (!get_u8(tag)) return false;
+
+    switch (static_cast<ValueTag>(tag)) {
+        case ValueTag::Null:
+            value = db::DBNull{};
+            return true;
+        case ValueTag::Int: {
+            uint64_t v;
+            if (!get_u64(v)) return false;
+            value = static_cast<db::DBInt>(v);
+            return true;
+        }
+        case ValueTag::Float: {
+            uint64_t bits;
+            if (!get_u64(bits)) return false;
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            value = d;
+            return true;
+        }
+        case ValueTag::Text: {
+            std::string s;
+            if (!get_string(s)) return false;
+            value = std::move(s);
+            return true;
+        }
+    }
+    return false; // Unknown tag
+}
+
+std::string Decoder::rest() {
+    std::string s(data_ + pos_, remaining());
+    pos_ = size_;
+    return s;
+}
+
+std::optional<size_t> read_frame(const char* data, size_t size, Frame& frame) {
+    if (size < kFrameHeaderSize) return 0;
+
+    uint32_t length = 0;
+    for (int i = 0; i < 4; ++i) {
+        length = (length << 8) | static_cast<uint8_t>(data[i]);
+    }
+
+    // The length must at least cover the type byte
+    if (length < 1 || length > kMaxFrameSize) return std::nullopt;
+    if (size < 4 + static_cast<size_t>(length)) return 0;
+
+    frame.type = static_cast<uint8_t>(data[4]);
+    frame.payload.assign(data + kFrameHeaderSize, length - 1);
+    return 4 + static_cast<size_t>(length);
+}
+
+void write_row_description(std::string& out, const std::vector<db::ColumnDef>& columns) {
+    Encoder enc(out);
+    size_t frame = enc.begin_frame(static_cast<uint8_t>(ServerMessage::RowDescription));
+    enc.put_u16(static_cast<uint16_t>(columns.size()));
+    for (const auto& col : columns) {
+        enc.put_string(col.name);
+        enc.put_u8(static_cast<uint8_t>(col.type));
+    }
+    enc.end_frame(frame);
+}
+
+void write_row_batch(std::string& out, const std::vector<db::Row>& rows,
+                     size_t begin, size_t end) {
+    Encoder enc(out);
+    size_t frame = enc.begin_frame(static_cast<uint8_t>(ServerMessage::RowBatch));
+    enc.put_u32(static_cast<uint32_t>(end - begin));
+    for (size_t i = begin; i < end; ++i) {
+        for (const auto& value : rows[i]) {
+            enc.put_value(value);
+        }
+    }
+    enc.end_frame(frame);
+}
+
+void write_complete(std::string& out, uint64_t count, const std::string& message) {
+    Encoder enc(out);
+    size_t frame = enc.begin_frame(static_cast<uint8_t>(ServerMessage::Complete));
+    enc.put_u64(count);
+    enc.put_string(message);
+    enc.end_frame(frame);
+}
+
+void write_prepare_ok(std::string& out, uint32_t statement_id, uint16_t param_count) {
+    Encoder enc(out);
+    size_t frame = enc.begin_frame(static_cast<uint8_t>(ServerMessage::PrepareOk));
+    enc.put_u32(statement_id);
+    enc.put_u16(param_count);
+    enc.end_frame(frame);
+}
+
+void write_error(std::string& out, const std::string& message) {
+    Encoder enc(out);
+    size_t frame = enc.begin_frame(static_cast<uint8_t>(ServerMessage::Error));
+    enc.put_string(message);
+    enc.end_frame(frame);
+}
+
+} // namespace server
+} // namespace toydb
@@ -0,0 +1,335 @@
+#include "../../include/server/server.h"
+#include <iostream>
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <vector>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+namespace toydb {
+namespace server {
+
+namespace {
+
+// Size of each recv() call into a connection's read buffer
+constexpr size_t kReadChunkSize = 64 * 1024;
+
+std::runtime_error system_error(const std::string& what) {
+    return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+} // namespace
+
+Server::Server(std::shared_ptr<db::Database> db, ServerOptions options)
+    : db_(std::move(db)), options_(std::move(options)) {
+}
+
+Server::~Server() {
+    for (auto& [fd, _] : connections_) {
+        ::close(fd);
+    }
+    if (listen_fd_ >= 0) ::close(listen_fd_);
+    if (epoll_fd_ >= 0) ::close(epoll_fd_);
+    if (wakeup_fd_ >= 0) ::close(wakeup_fd_);
+    if (!options_.unix_socket.empty()) {
+        ::unlink(options_.unix_socket.c_str());
+    }
+}
+
+void Server::listen() {
+    if (!options_.unix_socket.empty()) {
+        sockaddr_un addr{};
+        if (options_.unix_socket.size() >= sizeof(addr.sun_path)) {
+            throw std::runtime_error("Unix socket path too long: " + options_.unix_socket);
+        }
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, options_.unix_socket.c_str(), sizeof(addr.sun_path) - 1);
+
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listen_fd_ < 0) throw system_error("socket");
+
+        ::unlink(options_.unix_socket.c_str());
+        if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            throw system_error("bind " + options_.unix_socket);
+        }
+    } else {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(options_.port);
+        if (::inet_pton(AF_INET, options_.host.c_str(), &addr.sin_addr) != 1) {
+            throw std::runtime_error("Invalid listen address: " + options_.host);
+        }
+
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listen_fd_ < 0) throw system_error("socket");
+
+        int one = 1;
+        ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            throw system_error("bind " + options_.host + ":" + std::to_string(options_.port));
+        }
+    }
+
+    if (::listen(listen_fd_, SOMAXCONN) < 0) throw system_error("listen");
+}
+
+void Server::run() {
+    listen();
+
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0) throw system_error("epoll_create1");
+
+    wakeup_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeup_fd_ < 0) throw system_error("eventfd");
+
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = listen_fd_;
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd_, &ev);
+    ev.data.fd = wakeup_fd_;
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wakeup_fd_, &ev);
+
+    if (options_.unix_socket.empty()) {
+        std::cout << "Listening on " << options_.host << ":" << options_.port << std::endl;
+    } else {
+        std::cout << "Listening on " << options_.unix_socket << std::endl;
+    }
+
+    running_ = true;
+    std::vector<epoll_event> events(options_.max_events);
+
+    while (running_) {
+        int n = ::epoll_wait(epoll_fd_, events.data(), static_cast<int>(events.size()), -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw system_error("epoll_wait");
+        }
+
+        for (int i = 0; i < n; ++i) {
+            int fd = events[i].data.fd;
+
+            if (fd == listen_fd_) {
+                accept_connections();
+                continue;
+            }
+            if (fd == wakeup_fd_) {
+                running_ = false;
+                continue;
+            }
+
+            auto it = connections_.find(fd);
+            if (it == connections_.end()) continue;
+            Connection& conn = *it->second;
+
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                close_connection(fd);
+                continue;
+            }
+            if (events[i].events & EPOLLOUT) {
+                handle_writable(conn);
+                if (connections_.find(fd) == connections_.end()) continue;
+            }
+            if (events[i].events & EPOLLIN) {
+                handle_readable(conn);
+            }
+        }
+    }
+}
+
+void Server::stop() {
+    running_ = false;
+    if (wakeup_fd_ >= 0) {
+        uint64_t one = 1;
+        // Best effort: the loop also re-checks running_ after EINTR
+        [[maybe_unused]] ssize_t n = ::write(wakeup_fd_, &one, sizeof(one));
+    }
+}
+
+void Server::accept_connections() {
+    while (true) {
+        int fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                std::cerr << "accept: " << std::strerror(errno) << std::endl;
+            }
+            return;
+        }
+
+        if (options_.unix_socket.empty()) {
+            int one = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            ::close(fd);
+            continue;
+        }
+
+        auto conn = std::make_unique<Connection>(fd, db_);
+        conn->events = ev.events;
+        connections_[fd] = std::move(conn);
+    }
+}
+
+void Server::handle_readable(Connection& conn) {
+    char buf[kReadChunkSize];
+    size_t received = 0;
+
+    // Bounded so one busy client cannot starve the others; epoll reports the
+    // socket again while data is left
+    while (received < options_.max_read_per_event) {
+        ssize_t n = ::recv(conn.fd, buf, sizeof(buf), 0);
+        if (n > 0) {
+            conn.read_buffer.append(buf, static_cast<size_t>(n));
+            received += static_cast<size_t>(n);
+            continue;
+        }
+        if (n == 0) {
+            // Peer shut down its side; requests it already sent still get
+            // their responses
+            conn.read_closed = true;
+            break;
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+
+        close_connection(conn.fd);
+        return;
+    }
+
+    process_frames(conn);
+}
+
+void Server::handle_writable(Connection& conn) {
+    if (!flush(conn)) {
+        close_connection(conn.fd);
+        return;
+    }
+
+    // Resume pipelined requests held back while the output was full
+    if (conn.write_buffer.size() < options_.max_pending_output &&
+        (!conn.read_buffer.empty() || conn.read_closed)) {
+        if (!process_frames(conn)) return;
+    }
+
+    if (conn.closing && conn.write_buffer.empty()) {
+        close_connection(conn.fd);
+        return;
+    }
+    update_interest(conn);
+}
+
+bool Server::process_frames(Connection& conn) {
+    size_t offset = 0;
+    bool drained = false;
+
+    // Clients may pipeline any number of requests without waiting for the
+    // replies. Decode them in batches, execute each batch back-to-back and
+    // send all of the responses with as few writes as possible.
+    while (!conn.closing && conn.write_buffer.size() < options_.max_pending_output) {
+        frames_.clear();
+
+        bool invalid = false;
+
+        while (frames_.size() < options_.max_pipeline_depth) {
+            Frame frame;
+            auto consumed = read_frame(conn.read_buffer.data() + offset,
+                                       conn.read_buffer.size() - offset, frame);
+            if (!consumed) {
+                invalid = true;
+                break;
+            }
+            if (*consumed == 0) break; // Wait for the rest of the frame
+            offset += *consumed;
+            frames_.push_back(std::move(frame));
+        }
+
+        if (!frames_.empty() && !conn.session.handle_frames(frames_, conn.write_buffer)) {
+            conn.closing = true;
+        } else if (invalid) {
+            // Corrupt frame header; nothing sensible can follow
+            write_error(conn.write_buffer, "Invalid frame");
+            conn.closing = true;
+        } else if (frames_.size() < options_.max_pipeline_depth) {
+            drained = true;
+            break; // Everything buffered has been handled
+        }
+    }
+
+    conn.read_buffer.erase(0, offset);
+
+    // No more requests can arrive; a trailing partial frame is dropped
+    if (conn.read_closed && drained) {
+        conn.closing = true;
+    }
+
+    if (!flush(conn)) {
+        close_connection(conn.fd);
+        return false;
+    }
+    if (conn.closing && conn.write_buffer.empty()) {
+        close_connection(conn.fd);
+        return false;
+    }
+    update_interest(conn);
+    return true;
+}
+
+bool Server::flush(Connection& conn) {
+    while (conn.write_offset < conn.write_buffer.size()) {
+        ssize_t n = ::send(conn.fd, conn.write_buffer.data() + conn.write_offset,
+                           conn.write_buffer.size() - conn.write_offset, MSG_NOSIGNAL);
+        if (n > 0) {
+            conn.write_offset += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+        return false;
+    }
+
+    conn.write_buffer.clear();
+    conn.write_offset = 0;
+    return true;
+}
+
+void Server::update_interest(Connection& conn) {
+    uint32_t events = 0;
+
+    // Apply backpressure: stop reading new requests while too many
+    // responses are still waiting to be sent
+    if (!conn.closing && !conn.read_closed &&
+        conn.write_buffer.size() < options_.max_pending_output) {
+        events |= EPOLLIN;
+    }
+    if (!conn.write_buffer.empty()) {
+        events |= EPOLLOUT;
+    }
+    if (events == conn.events) return;
+
+    epoll_event ev{};
+    ev.events = events;
+    ev.data.fd = conn.fd;
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, conn.fd, &ev);
+    conn.events = events;
+}
+
+void Server::close_connection(int fd) {
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    connections_.erase(fd);
+}
+
+} // namespace server
+} // namespace toydb
@@ -0,0 +1,626 @@
+#include "../../include/server/session.h"
+#include "../../include/metrics/metrics.h"
+#include "../../include/metrics/trace.h"
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <variant>
+
+namespace toydb {
+namespace server {
+
+Session::Session(std::shared_ptr<db::Database> db) : db_(std::move(db)) {
+}
+
+bool Session::handle_frame(const Frame& frame, std::string& out) {
+    Decoder dec(frame.payload);
+
+    switch (static_cast<ClientMessage>(frame.type)) {
+        case ClientMessage::Query:
+            handle_query(dec.rest(), out);
+            return true;
+        case ClientMessage::Prepare:
+            handle_prepare(dec, out);
+            return true;
+        case ClientMessage::Execute:
+            handle_execute(dec, out);
+            return true;
+        case ClientMessage::Close:
+            handle_close(dec, out);
+            return true;
+        case ClientMessage::Terminate:
+            return false;
+    }
+
+    write_error(out, "Unknown message type: " + std::to_string(frame.type));
+    return true;
+}
+
+bool Session::handle_frames(const std::vector<Frame>& frames, std::string& out) {
+    size_t i = 0;
+    while (i < frames.size()) {
+        const Frame& frame = frames[i];
+
+        // Gather consecutive executions of the same prepared point lookup
+        uint32_t statement_id;
+        Decoder dec(frame.payload);
+        if (frame.type == static_cast<uint8_t>(ClientMessage::Execute) &&
+            dec.get_u32(statement_id)) {
+            auto it = prepared_.find(statement_id);
+            if (it != prepared_.end() && it->second.point_lookup) {
+                size_t end = i + 1;
+                while (end < frames.size() &&
+                       frames[end].type == frame.type &&
+                       frames[end].payload.compare(0, 4, frame.payload, 0, 4) == 0) {
+                    ++end;
+                }
+                execute_point_lookups(*it->second.point_lookup, frames, i, end, out);
+                i = end;
+                continue;
+            }
+        }
+
+        if (!handle_frame(frame, out)) {
+            return false;
+        }
+        ++i;
+    }
+    return true;
+}
+
+void Session::handle_query(const std::string& sql, std::string& out) {
+    auto& slow_log = metrics::SlowQueryLog::instance();
+    profiling_ = slow_log.enabled();
+    profile_ = metrics::QueryProfile{};
+    auto start = std::chrono::steady_clock::now();
+    TOYDB_TRACE_SPAN("query", "query");
+
+    auto statement = [&] {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::parse));
+        return parser_.parse(sql);
+    }();
+    if (!statement) {
+        write_error(out, parser_.last_error());
+    } else {
+        execute(*statement, out);
+    }
+
+    if (profiling_) {
+        profile_.total = std::chrono::steady_clock::now() - start;
+        profile_.sql = sql;
+        slow_log.record(std::move(profile_));
+        profiling_ = false;
+    }
+}
+
+void Session::record_scan(const db::ScanStats& stats, size_t rows_returned) {
+    if (profiling_) {
+        profile_.access_path = stats.access_path;
+        profile_.rows_examined = stats.rows_examined;
+        profile_.rows_returned = rows_returned;
+    }
+}
+
+void Session::handle_prepare(Decoder& dec, std::string& out) {
+    uint32_t statement_id;
+    if (!dec.get_u32(statement_id)) {
+        write_error(out, "Malformed Prepare message");
+        return;
+    }
+
+    auto statement = parser_.parse(dec.rest());
+    if (!statement) {
+        write_error(out, parser_.last_error());
+        return;
+    }
+
+    PreparedStatement prepared{*statement, 0, as_point_lookup(*statement)};
+    prepared.param_count = static_cast<uint16_t>(collect_placeholders(prepared.statement).size());
+    uint16_t param_count = prepared.param_count;
+    prepared_[statement_id] = std::move(prepared);
+
+    write_prepare_ok(out, statement_id, param_count);
+}
+
+void Session::handle_execute(Decoder& dec, std::string& out) {
+    uint32_t statement_id;
+    uint16_t param_count;
+    if (!dec.get_u32(statement_id) || !dec.get_u16(param_count)) {
+        write_error(out, "Malformed Execute message");
+        return;
+    }
+
+    auto it = prepared_.find(statement_id);
+    if (it == prepared_.end()) {
+        write_error(out, "Unknown prepared statement: " + std::to_string(statement_id));
+        return;
+    }
+
+    if (param_count != it->second.param_count) {
+        write_error(out, "Expected " + std::to_string(it->second.param_count) +
+                         " parameter(s), got " + std::to_string(param_count));
+        return;
+    }
+
+    // Bind the parameters into a copy of the parsed statement
+    parser::Statement bound = it->second.statement;
+    auto placeholders = collect_placeholders(bound);
+    for (auto* placeholder : placeholders) {
+        db::DBValue value;
+        if (!dec.get_value(value)) {
+            write_error(out, "Malformed parameter in Execute message");
+            return;
+        }
+        *placeholder = param_to_literal(value);
+    }
+
+    execute(bound, out);
+}
+
+void Session::handle_close(Decoder& dec, std::string& out) {
+    uint32_t statement_id;
+    if (!dec.get_u32(statement_id)) {
+        write_error(out, "Malformed Close message");
+        return;
+    }
+
+    prepared_.erase(statement_id);
+    write_complete(out, 0, "Statement closed.");
+}
+
+void Session::execute_point_lookups(const PointLookup& lookup,
+                                    const std::vector<Frame>& frames,
+                                    size_t begin, size_t end, std::string& out) {
+    auto table = db_->get_table(lookup.table_name);
+    if (!table) {
+        for (size_t i = begin; i < end; ++i) {
+            write_error(out, "Table not found: " + lookup.table_name);
+        }
+        return;
+    }
+
+    // Decode every parameter up front, coerced to the column's type the way
+    // binding it into the statement would; errors keep their frame's slot
+    const auto& columns = table->columns();
+    auto column = table->column_index(lookup.column_name);
+    db::ColumnType key_type = column ? columns[*column].type : db::ColumnType::Text;
+    std::vector<db::DBValue> keys;
+    std::vector<std::string> errors(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+        Decoder dec(frames[i].payload);
+        uint32_t statement_id;
+        uint16_t param_count;
+        db::DBValue key;
+        if (!dec.get_u32(statement_id) || !dec.get_u16(param_count)) {
+            errors[i - begin] = "Malformed Execute message";
+        } else if (param_count != 1) {
+            errors[i - begin] = "Expected 1 parameter(s), got " + std::to_string(param_count);
+        } else if (!dec.get_value(key)) {
+            errors[i - begin] = "Malformed parameter in Execute message";
+        } else {
+            keys.push_back(coerce_param(key, key_type));
+        }
+    }
+
+    // Resolve the selected columns as handle_select does
+    std::vector<size_t> projection;
+    std::vector<db::ColumnDef> output;
+    for (const auto& name : lookup.columns) {
+        auto idx = table->column_index(name);
+        if (!idx) {
+            for (auto& error : errors) {
+                if (error.empty()) {
+                    error = "Column not found: " + name;
+                }
+            }
+            keys.clear();
+            break;
+        }
+        projection.push_back(*idx);
+        output.push_back(columns[*idx]);
+    }
+    if (lookup.columns.empty()) {
+        output = columns;
+    }
+
+    // Primary key lookups are answered by one batched probe
+    std::vector<std::vector<db::Row>> results(keys.size());
+    if (column && columns[*column].primary_key) {
+        auto rows = table->get_rows(keys);
+        for (size_t k = 0; k < rows.size(); ++k) {
+            if (!rows[k]) {
+                continue;
+            }
+            if (projection.empty()) {
+                results[k].push_back(std::move(*rows[k]));
+            } else {
+                db::Row projected;
+                projected.reserve(projection.size());
+                for (size_t idx : projection) {
+                    projected.push_back((*rows[k])[idx]);
+                }
+                results[k].push_back(std::move(projected));
+            }
+        }
+    } else {
+        db::Conditions conditions(1);
+        conditions[0].column_name = lookup.column_name;
+        conditions[0].op = "=";
+        for (size_t k = 0; k < keys.size(); ++k) {
+            conditions[0].value = keys[k];
+            results[k] = projection.empty() ? table->select(conditions)
+                                            : table->select(conditions, projection);
+        }
+    }
+
+    // The row description is identical for every lookup in the run
+    std::string description;
+    write_row_description(description, output);
+
+    size_t next = 0;
+    for (const auto& error : errors) {
+        if (!error.empty()) {
+            write_error(out, error);
+            continue;
+        }
+        const auto& rows = results[next++];
+        out.append(description);
+        for (size_t first = 0; first < rows.size(); first += kRowBatchSize) {
+            write_row_batch(out, rows, first, std::min(rows.size(), first + kRowBatchSize));
+        }
+        write_complete(out, rows.size(), std::to_string(rows.size()) + " row(s) returned.");
+    }
+}
+
+void Session::execute(const parser::Statement& statement, std::string& out) {
+    db::ArenaScope arena_scope(arena_);
+    try {
+        std::visit([this, &out](const auto& stmt) {
+            using T = std::decay_t<decltype(stmt)>;
+
+            if constexpr (std::is_same_v<T, parser::CreateTableStmt>) {
+                handle_create_table(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::CreateIndexStmt>) {
+                handle_create_index(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::InsertStmt>) {
+                handle_insert(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::SelectStmt>) {
+                handle_select(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::UpdateStmt>) {
+                handle_update(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::DeleteStmt>) {
+                handle_delete(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::DropTableStmt>) {
+                handle_drop_table(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::ShowTablesStmt>) {
+                handle_show_tables(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::ShowTableStatusStmt>) {
+                handle_show_table_status(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::ShowMetricsStmt>) {
+                handle_show_metrics(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::BeginTransactionStmt>) {
+                handle_begin_transaction(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::CommitTransactionStmt>) {
+                handle_commit_transaction(stmt, out);
+            } else if constexpr (std::is_same_v<T, parser::AbortTransactionStmt>) {
+                handle_abort_transaction(stmt, out);
+            }
+        }, statement);
+    } catch (const std::exception& e) {
+        write_error(out, e.what());
+    }
+}
+
+void Session::handle_create_table(const parser::CreateTableStmt& stmt, std::string& out) {
+    std::vector<db::ColumnDef> columns;
+    for (const auto& col : stmt.columns) {
+        columns.push_back(parser::convert_column_def(col));
+    }
+
+    if (db_->create_table(stmt.table_name, columns, parser::convert_storage_engine(stmt))) {
+        write_complete(out, 0, "Table created: " + stmt.table_name);
+    } else {
+        write_error(out, "Could not create table: " + stmt.table_name);
+    }
+}
+
+void Session::handle_create_index(const parser::CreateIndexStmt& stmt, std::string& out) {
+    auto table = db_->get_table(stmt.table_name);
+    if (!table) {
+        write_error(out, "Table not found: " + stmt.table_name);
+        return;
+    }
+
+    if (db_->create_index(stmt.table_name, parser::convert_index_def(stmt, table->columns()))) {
+        write_complete(out, 0, "Index created: " + stmt.index_name);
+    } else {
+        write_error(out, "Could not create index: " + stmt.index_name);
+    }
+}
+
+void Session::handle_insert(const parser::InsertStmt& stmt, std::string& out) {
+    auto table = db_->get_table(stmt.table_name);
+    if (!table) {
+        write_error(out, "Table not found: " + stmt.table_name);
+        return;
+    }
+
+    const auto& columns = table->columns();
+
+    size_t success_count = 0;
+    for (const auto& value_strs : stmt.values) {
+        db::Row row;
+        {
+            metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+            row = parser::convert_row(value_strs, columns, stmt.columns);
+        }
+
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::execute));
+        if (table->insert_row(row)) {
+            success_count++;
+        }
+    }
+
+    if (profiling_) {
+        profile_.rows_returned = success_count;
+    }
+
+    write_complete(out, success_count, std::to_string(success_count) + " row(s) inserted.");
+}
+
+void Session::handle_select(const parser::SelectStmt& stmt, std::string& out) {
+    auto table = db_->get_table(stmt.table_name);
+    if (!table) {
+        write_error(out, "Table not found: " + stmt.table_name);
+        return;
+    }
+
+    const auto& columns = table->columns();
+
+    db::Conditions conditions(arena_.resource());
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+        TOYDB_TRACE_SPAN("plan", "query");
+        for (const auto& cond : stmt.conditions) {
+            conditions.push_back(parser::convert_condition(cond, columns));
+        }
+    }
+
+    // Resolve the selected columns; SELECT * keeps them all
+    std::vector<size_t> projection;
+    std::vector<db::ColumnDef> output;
+    for (const auto& name : stmt.columns) {
+        auto idx = table->column_index(name);
+        if (!idx) {
+            write_error(out, "Column not found: " + name);
+            return;
+        }
+        projection.push_back(*idx);
+        output.push_back(columns[*idx]);
+    }
+    if (stmt.columns.empty()) {
+        output = columns;
+    }
+
+    db::ScanStats stats;
+    std::vector<db::Row> rows;
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::execute));
+        rows = projection.empty() ? table->select(conditions, &stats)
+                                  : table->select(conditions, projection, &stats);
+    }
+    record_scan(stats, rows.size());
+
+    metrics::PhaseTimer timer(phase(&metrics::QueryProfile::format));
+    TOYDB_TRACE_SPAN("format", "query");
+    write_rows(rows, output, out);
+}
+
+void Session::handle_update(const parser::UpdateStmt& stmt, std::string& out) {
+    auto table = db_->get_table(stmt.table_name);
+    if (!table) {
+        write_error(out, "Table not found: " + stmt.table_name);
+        return;
+    }
+
+    const auto& columns = table->columns();
+
+    db::Conditions conditions(arena_.resource());
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+        TOYDB_TRACE_SPAN("plan", "query");
+        for (const auto& cond : stmt.conditions) {
+            conditions.push_back(parser::convert_condition(cond, columns));
+        }
+    }
+
+    std::unordered_map<std::string, db::DBValue> updates;
+    for (const auto& [col_name, value_str] : stmt.updates) {
+        db::ColumnType col_type = db::ColumnType::Text;
+        auto col_idx = table->column_index(col_name);
+        if (col_idx) {
+            col_type = columns[*col_idx].type;
+        }
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+        updates[col_name] = parser::parse_value(value_str, col_type);
+    }
+
+    db::ScanStats stats;
+    size_t count;
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::execute));
+        count = table->update(updates, conditions, &stats);
+    }
+    record_scan(stats, count);
+    write_complete(out, count, std::to_string(count) + " row(s) updated.");
+}
+
+void Session::handle_delete(const parser::DeleteStmt& stmt, std::string& out) {
+    auto table = db_->get_table(stmt.table_name);
+    if (!table) {
+        write_error(out, "Table not found: " + stmt.table_name);
+        return;
+    }
+
+    const auto& columns = table->columns();
+
+    db::Conditions conditions(arena_.resource());
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::convert));
+        TOYDB_TRACE_SPAN("plan", "query");
+        for (const auto& cond : stmt.conditions) {
+            conditions.push_back(parser::convert_condition(cond, columns));
+        }
+    }
+
+    db::ScanStats stats;
+    size_t count;
+    {
+        metrics::PhaseTimer timer(phase(&metrics::QueryProfile::execute));
+        count = table->remove(conditions, &stats);
+    }
+    record_scan(stats, count);
+    write_complete(out, count, std::to_string(count) + " row(s) deleted.");
+}
+
+void Session::handle_drop_table(const parser::DropTableStmt& stmt, std::string& out) {
+    if (db_->drop_table(stmt.table_name)) {
+        write_complete(out, 0, "Table dropped: " + stmt.table_name);
+    } else {
+        write_error(out, "Table doesn't exist: " + stmt.table_name);
+    }
+}
+
+void Session::handle_show_tables(const parser::ShowTablesStmt&, std::string& out) {
+    std::vector<db::ColumnDef> columns = {{"TABLE_NAME", db::ColumnType::Text}};
+    std::vector<db::Row> rows;
+    for (const auto& name : db_->list_tables()) {
+        rows.push_back({name});
+    }
+    write_rows(rows, columns, out);
+}
+
+void Session::handle_show_metrics(const parser::ShowMetricsStmt&, std::string& out) {
+    std::vector<db::ColumnDef> columns = {{"METRIC", db::ColumnType::Text},
+                                          {"VALUE", db::ColumnType::Text}};
+    std::vector<db::Row> rows;
+    for (const auto& [name, value] : metrics::Registry::instance().rows()) {
+        rows.push_back({name, value});
+    }
+    write_rows(rows, columns, out);
+}
+
+void Session::handle_show_table_status(const parser::ShowTableStatusStmt&, std::string& out) {
+    write_rows(db_->table_status_rows(), db::Database::table_status_columns(), out);
+}
+
+void Session::handle_begin_transaction(const parser::BeginTransactionStmt&, std::string& out) {
+    uint64_t transaction_id = db_->begin_transaction();
+    write_complete(out, transaction_id,
+                   "Transaction started with ID: " + std::to_string(transaction_id));
+}
+
+void Session::handle_commit_transaction(const parser::CommitTransactionStmt& stmt, std::string& out) {
+    db_->commit_transaction(stmt.transaction_id);
+    write_complete(out, 0, "Transaction " + std::to_string(stmt.transaction_id) +
+                           " committed successfully.");
+}
+
+void Session::handle_abort_transaction(const parser::AbortTransactionStmt& stmt, std::string& out) {
+    db_->abort_transaction(stmt.transaction_id);
+    write_complete(out, 0, "Transaction " + std::to_string(stmt.transaction_id) +
+                           " aborted successfully.");
+}
+
+void Session::write_rows(const std::vector<db::Row>& rows,
+                         const std::vector<db::ColumnDef>& columns, std::string& out) {
+    write_row_description(out, columns);
+    for (size_t begin = 0; begin < rows.size(); begin += kRowBatchSize) {
+        write_row_batch(out, rows, begin, std::min(rows.size(), begin + kRowBatchSize));
+    }
+    write_complete(out, rows.size(), std::to_string(rows.size()) + " row(s) returned.");
+}
+
+std::optional<PointLookup> as_point_lookup(const parser::Statement& statement) {
+    const auto* select = std::get_if<parser::SelectStmt>(&statement);
+    if (!select || select->conditions.size() != 1) {
+        return std::nullopt;
+    }
+
+    const auto& cond = select->conditions[0];
+    if (cond.op != "=" || cond.value != "?") {
+        return std::nullopt;
+    }
+
+    return PointLookup{select->table_name, cond.column, select->columns};
+}
+
+std::vector<std::string*> collect_placeholders(parser::Statement& statement) {
+    std::vector<std::string*> placeholders;
+    auto collect = [&placeholders](std::string& value) {
+        if (value == "?") {
+            placeholders.push_back(&value);
+        }
+    };
+    std::function<void(std::vector<parser::Condition>&)> collect_conditions =
+        [&](std::vector<parser::Condition>& conditions) {
+            for (auto& cond : conditions) {
+                collect(cond.value);
+                for (auto& value : cond.values) {
+                    collect(value);
+                }
+                for (auto& branch : cond.any_of) {
+                    collect_conditions(branch);
+                }
+            }
+        };
+
+    std::visit([&](auto& stmt) {
+        using T = std::decay_t<decltype(stmt)>;
+
+        if constexpr (std::is_same_v<T, parser::InsertStmt>) {
+            for (auto& row : stmt.values) {
+                for (auto& value : row) {
+                    collect(value);
+                }
+            }
+        } else if constexpr (std::is_same_v<T, parser::SelectStmt>) {
+            collect_conditions(stmt.conditions);
+        } else if constexpr (std::is_same_v<T, parser::UpdateStmt>) {
+            for (auto& update : stmt.updates) {
+                collect(update.second);
+            }
+            collect_conditions(stmt.conditions);
+        } else if constexpr (std::is_same_v<T, parser::DeleteStmt>) {
+            collect_conditions(stmt.conditions);
+        }
+    }, statement);
+
+    return placeholders;
+}
+
+std::string param_to_literal(const db::DBValue& value) {
+    if (std::holds_alternative<db::DBInt>(value)) {
+        return std::to_string(std::get<db::DBInt>(value));
+    }
+    if (std::holds_alternative<db::DBFloat>(value)) {
+        std::ostringstream oss;
+        oss << std::setprecision(std::numeric_limits<double>::max_digits10)
+            << std::get<db::DBFloat>(value);
+        return oss.str();
+    }
+    if (std::holds_alternative<db::DBText>(value)) {
+        // Quoted so that the parser always treats it as text
+        return "'" + std::get<db::DBText>(value) + "'";
+    }
+    return "NULL";
+}
+
+db::DBValue coerce_param(const db::DBValue& value, db::ColumnType type) {
+    return parser::parse_value(param_to_literal(value), type);
+}
+
+} // namespace server
+} // namespace toydb
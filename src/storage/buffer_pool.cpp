@@ -0,0 +1,535 @@
+#include "../../include/storage/buffer_pool.h"
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace toydb {
+namespace storage {
+
+// PageHandle implementation
+PageHandle& PageHandle::operator=(PageHandle&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool_ = other.pool_;
+        id_ = other.id_;
+        data_ = other.data_;
+        dirty_ = other.dirty_;
+        other.pool_ = nullptr;
+        other.data_ = nullptr;
+    }
+    return *this;
+}
+
+void PageHandle::release() {
+    if (pool_ && data_) {
+        pool_->unpin_page(id_, dirty_);
+    }
+    pool_ = nullptr;
+    data_ = nullptr;
+}
+
+// BufferPool implementation
+BufferPool::BufferPool(const std::string& path, BufferPoolOptions options)
+    : options_(options) {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw std::runtime_error("Cannot open page file " + path + ": " + std::strerror(errno));
+    }
+
+    struct stat st;
+    if (::fstat(fd_, &st) == 0) {
+        num_pages_ = static_cast<PageId>(st.st_size) / kPageSize;
+    }
+
+    num_frames_ = std::max<size_t>(8, options_.memory_budget / kPageSize);
+    readahead_window_ = options_.readahead_min_pages;
+    a1in_capacity_ = std::max<size_t>(1, static_cast<size_t>(num_frames_ * options_.a1in_fraction));
+    a1out_capacity_ = std::max<size_t>(1, static_cast<size_t>(num_frames_ * options_.a1out_fraction));
+
+    void* memory = nullptr;
+    if (::posix_memalign(&memory, kPageSize, num_frames_ * kPageSize) != 0) {
+        ::close(fd_);
+        throw std::bad_alloc();
+    }
+    memory_ = static_cast<char*>(memory);
+
+    // The destructor does not run if the constructor throws
+    try {
+        frames_.resize(num_frames_);
+        free_frames_.reserve(num_frames_);
+        for (size_t i = num_frames_; i > 0; --i) {
+            free_frames_.push_back(i - 1);
+        }
+
+        io_ = make_io_backend(options_.io_backend);
+        if (!io_) {
+            throw std::runtime_error("io_uring backend requested but not available");
+        }
+
+        // All frames live in one allocation, registered once as a fixed buffer
+        buffers_registered_ = io_->register_buffers({{memory_, num_frames_ * kPageSize}});
+    } catch (...) {
+        io_.reset();
+        std::free(memory_);
+        ::close(fd_);
+        throw;
+    }
+}
+
+BufferPool::~BufferPool() {
+    flush_all();
+
+    // Let outstanding read-ahead finish before the frames are freed
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<IOCompletion> completions;
+        while (io_->in_flight() > 0) {
+            completions.clear();
+            io_->reap(completions, io_->in_flight());
+        }
+    }
+
+    io_.reset();
+    std::free(memory_);
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+PageHandle BufferPool::fetch_page(PageId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    note_access(id);
+
+    auto it = page_table_.find(id);
+    if (it != page_table_.end() && frames_[it->second].io_pending) {
+        // Read-ahead is still in flight; a failed read drops the page
+        wait_for_frame(it->second);
+        it = page_table_.find(id);
+    }
+
+    if (it != page_table_.end()) {
+        Frame& frame = frames_[it->second];
+        stats_.hits++;
+
+        if (frame.prefetched) {
+            frame.prefetched = false;
+            stats_.readahead_hits++;
+        }
+
+        // Am is LRU; pages in A1in keep their FIFO position so that a burst
+        // of correlated accesses does not make a page look hot
+        if (frame.queue == Queue::Am) {
+            am_.splice(am_.begin(), am_, frame.position);
+        }
+
+        frame.pin_count++;
+        return PageHandle(this, id, frame_data(it->second));
+    }
+
+    stats_.misses++;
+
+    if (id >= num_pages_) {
+        return PageHandle();
+    }
+
+    // Pages seen again shortly after leaving A1in are hot. Check before
+    // making room, since the eviction below may push this page out of A1out.
+    bool hot = false;
+    auto ghost = a1out_index_.find(id);
+    if (ghost != a1out_index_.end()) {
+        a1out_.erase(ghost->second);
+        a1out_index_.erase(ghost);
+        hot = true;
+    }
+
+    long slot = acquire_frame();
+    if (slot < 0) {
+        return PageHandle();
+    }
+    size_t index = static_cast<size_t>(slot);
+
+    if (!read_page(index, id)) {
+        free_frames_.push_back(index);
+        return PageHandle();
+    }
+
+    Frame& frame = frames_[index];
+    frame.page_id = id;
+    frame.pin_count = 1;
+    frame.dirty = false;
+
+    if (hot) {
+        am_.push_front(index);
+        frame.queue = Queue::Am;
+        frame.position = am_.begin();
+    } else {
+        a1in_.push_front(index);
+        frame.queue = Queue::A1in;
+        frame.position = a1in_.begin();
+    }
+
+    page_table_[id] = index;
+    return PageHandle(this, id, frame_data(index));
+}
+
+PageHandle BufferPool::new_page() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    long slot = acquire_frame();
+    if (slot < 0) {
+        return PageHandle();
+    }
+    size_t index = static_cast<size_t>(slot);
+
+    PageId id = num_pages_++;
+    std::memset(frame_data(index), 0, kPageSize);
+
+    Frame& frame = frames_[index];
+    frame.page_id = id;
+    frame.pin_count = 1;
+    frame.dirty = true;
+    a1in_.push_front(index);
+    frame.queue = Queue::A1in;
+    frame.position = a1in_.begin();
+
+    page_table_[id] = index;
+    return PageHandle(this, id, frame_data(index));
+}
+
+void BufferPool::prefetch(PageId first, size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    start_readahead(first, count);
+}
+
+void BufferPool::unpin_page(PageId id, bool dirty) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = page_table_.find(id);
+    if (it == page_table_.end()) {
+        return;
+    }
+
+    Frame& frame = frames_[it->second];
+    if (frame.pin_count > 0) {
+        frame.pin_count--;
+    }
+    frame.dirty = frame.dirty || dirty;
+}
+
+bool BufferPool::flush_page(PageId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = page_table_.find(id);
+    if (it == page_table_.end()) {
+        return false;
+    }
+    if (!frames_[it->second].dirty) {
+        return true;
+    }
+    return write_page(it->second);
+}
+
+void BufferPool::flush_all() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Queue every dirty page and submit them as one batch
+    std::vector<std::pair<uint64_t, size_t>> writes;
+    for (const auto& [id, index] : page_table_) {
+        if (frames_[index].dirty) {
+            writes.emplace_back(issue_io(IOOp::Write, index, id), index);
+        }
+    }
+
+    if (writes.empty()) {
+        return;
+    }
+
+    io_->submit();
+
+    for (const auto& [io_id, index] : writes) {
+        if (wait_io(io_id) == static_cast<int64_t>(kPageSize)) {
+            frames_[index].dirty = false;
+            stats_.writebacks++;
+        }
+    }
+}
+
+BufferPoolStats BufferPool::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+PageId BufferPool::page_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_pages_;
+}
+
+long BufferPool::acquire_frame() {
+    if (!free_frames_.empty()) {
+        size_t index = free_frames_.back();
+        free_frames_.pop_back();
+        return static_cast<long>(index);
+    }
+
+    // Frames of finished read-ahead become evictable again
+    if (!readahead_ios_.empty()) {
+        poll_completions(false);
+    }
+
+    // 2Q reclaim: drain A1in while it is over its share, otherwise evict
+    // the least recently used hot page. Fall back to the other queue when
+    // every candidate in the preferred one is pinned.
+    while (free_frames_.empty()) {
+        bool prefer_a1in = a1in_.size() > a1in_capacity_ || am_.empty();
+        if (prefer_a1in ? evict_from(a1in_, true) : evict_from(am_, false)) break;
+
+        // A1in frames still being read ahead free up shortly; wait for them
+        // rather than pushing hot pages out
+        if (prefer_a1in && !readahead_ios_.empty()) {
+            poll_completions(true);
+            continue;
+        }
+
+        if (prefer_a1in ? evict_from(am_, false) : evict_from(a1in_, true)) break;
+        if (readahead_ios_.empty()) return -1;
+
+        // Everything unpinned is still being read ahead
+        poll_completions(true);
+    }
+
+    size_t index = free_frames_.back();
+    free_frames_.pop_back();
+    return static_cast<long>(index);
+}
+
+long BufferPool::acquire_readahead_frame() {
+    if (free_frames_.empty() && a1in_.size() > a1in_capacity_) {
+        if (!readahead_ios_.empty()) {
+            poll_completions(false);
+        }
+        evict_from(a1in_, true, true);
+    }
+    if (free_frames_.empty()) {
+        return -1;
+    }
+
+    size_t index = free_frames_.back();
+    free_frames_.pop_back();
+    return static_cast<long>(index);
+}
+
+bool BufferPool::evict_from(std::list<size_t>& queue, bool remember, bool clean_only) {
+    // Oldest entries are at the back of both queues
+    for (auto it = queue.rbegin(); it != queue.rend(); ++it) {
+        size_t index = *it;
+        Frame& frame = frames_[index];
+        if (frame.pin_count > 0 || frame.io_pending) continue;
+        if (clean_only && frame.dirty) continue;
+
+        if (frame.dirty && !write_page(index)) {
+            continue;
+        }
+
+        PageId id = frame.page_id;
+        remove_from_queue(frame);
+        page_table_.erase(id);
+        free_frames_.push_back(index);
+        stats_.evictions++;
+
+        // Read-ahead pages that were never fetched have not been accessed,
+        // so they must not be promoted to Am if they are read later
+        if (remember && !frame.prefetched) {
+            remember_evicted(id);
+        }
+        frame.prefetched = false;
+        return true;
+    }
+    return false;
+}
+
+void BufferPool::remove_from_queue(Frame& frame) {
+    if (frame.queue == Queue::A1in) {
+        a1in_.erase(frame.position);
+    } else if (frame.queue == Queue::Am) {
+        am_.erase(frame.position);
+    }
+    frame.queue = Queue::None;
+}
+
+void BufferPool::remember_evicted(PageId id) {
+    a1out_.push_front(id);
+    a1out_index_[id] = a1out_.begin();
+
+    if (a1out_.size() > a1out_capacity_) {
+        a1out_index_.erase(a1out_.back());
+        a1out_.pop_back();
+    }
+}
+
+void BufferPool::note_access(PageId id) {
+    if (id == last_page_ + 1) {
+        sequential_run_++;
+    } else if (id != last_page_) {
+        sequential_run_ = 0;
+        readahead_window_ = options_.readahead_min_pages;
+        readahead_next_ = 0;
+    }
+    last_page_ = id;
+
+    // Two consecutive pages in a row look like a scan
+    if (sequential_run_ < 2 || readahead_window_ == 0) {
+        return;
+    }
+
+    // Top the window up once the scan gets within half a window of its end
+    PageId first = std::max(id + 1, readahead_next_);
+    if (first > id + readahead_window_ / 2 + 1) {
+        return;
+    }
+
+    start_readahead(first, id + readahead_window_ + 1 - first);
+    readahead_window_ = std::min(readahead_window_ * 2, options_.readahead_max_pages);
+}
+
+void BufferPool::start_readahead(PageId first, size_t count) {
+    PageId end = std::min<PageId>(first + count, num_pages_);
+    size_t issued = 0;
+
+    for (PageId id = first; id < end; ++id) {
+        if (page_table_.count(id)) continue;
+
+        // Keep read-ahead within the A1in share of the pool
+        if (readahead_ios_.size() >= a1in_capacity_) break;
+
+        // Read-ahead never evicts hot pages, writes back or waits; it stops
+        // when no frame is free for the taking
+        long slot = acquire_readahead_frame();
+        if (slot < 0) break;
+        size_t index = static_cast<size_t>(slot);
+
+        Frame& frame = frames_[index];
+        frame.page_id = id;
+        frame.pin_count = 0;
+        frame.dirty = false;
+        frame.io_pending = true;
+        frame.prefetched = true;
+        a1in_.push_front(index);
+        frame.queue = Queue::A1in;
+        frame.position = a1in_.begin();
+        page_table_[id] = index;
+
+        readahead_ios_[issue_io(IOOp::Read, index, id)] = index;
+        issued++;
+    }
+
+    if (issued > 0) {
+        io_->submit();
+        stats_.readahead_pages += issued;
+    }
+    readahead_next_ = std::max(readahead_next_, first + issued);
+}
+
+uint64_t BufferPool::issue_io(IOOp op, size_t frame, PageId id) {
+    IORequest request;
+    request.op = op;
+    request.fd = fd_;
+    request.buffer = frame_data(frame);
+    request.length = kPageSize;
+    request.offset = id * kPageSize;
+    request.buffer_index = buffers_registered_ ? 0 : -1;
+    request.user_data = next_io_id_++;
+    io_->prepare(request);
+    return request.user_data;
+}
+
+int64_t BufferPool::wait_io(uint64_t io_id) {
+    while (true) {
+        auto it = finished_ios_.find(io_id);
+        if (it != finished_ios_.end()) {
+            int64_t result = it->second;
+            finished_ios_.erase(it);
+            return result;
+        }
+        poll_completions(true);
+    }
+}
+
+void BufferPool::wait_for_frame(size_t frame) {
+    while (frames_[frame].io_pending) {
+        poll_completions(true);
+    }
+}
+
+void BufferPool::poll_completions(bool wait) {
+    std::vector<IOCompletion> completions;
+    io_->reap(completions, wait ? 1 : 0);
+    for (const auto& completion : completions) {
+        handle_completion(completion);
+    }
+}
+
+void BufferPool::handle_completion(const IOCompletion& completion) {
+    auto it = readahead_ios_.find(completion.user_data);
+    if (it == readahead_ios_.end()) {
+        finished_ios_[completion.user_data] = completion.result;
+        return;
+    }
+
+    size_t index = it->second;
+    readahead_ios_.erase(it);
+
+    Frame& frame = frames_[index];
+    frame.io_pending = false;
+
+    if (completion.result < 0) {
+        frame.prefetched = false;
+        // Drop the page; a later fetch will read it synchronously
+        remove_from_queue(frame);
+        page_table_.erase(frame.page_id);
+        free_frames_.push_back(index);
+        return;
+    }
+
+    if (completion.result < static_cast<int64_t>(kPageSize)) {
+        std::memset(frame_data(index) + completion.result, 0,
+                    kPageSize - static_cast<size_t>(completion.result));
+    }
+}
+
+bool BufferPool::read_page(size_t frame, PageId id) {
+    uint64_t io_id = issue_io(IOOp::Read, frame, id);
+    io_->submit();
+
+    int64_t result = wait_io(io_id);
+    if (result < 0) {
+        return false;
+    }
+
+    // Pages allocated but never written read back short
+    if (result < static_cast<int64_t>(kPageSize)) {
+        std::memset(frame_data(frame) + result, 0, kPageSize - static_cast<size_t>(result));
+    }
+    return true;
+}
+
+bool BufferPool::write_page(size_t frame) {
+    uint64_t io_id = issue_io(IOOp::Write, frame, frames_[frame].page_id);
+    io_->submit();
+
+    if (wait_io(io_id) != static_cast<int64_t>(kPageSize)) {
+        return false;
+    }
+
+    frames_[frame].dirty = false;
+    stats_.writebacks++;
+    return true;
+}
+
+} // namespace storage
+} // namespace toydb
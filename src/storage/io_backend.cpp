@@ -0,0 +1,152 @@
+#include "../../include/storage/io_backend.h"
+#include "../../include/storage/thread_pool.h"
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <cerrno>
+#include <unistd.h>
+
+namespace toydb {
+namespace storage {
+
+// Defined in io_uring_backend.cpp; returns nullptr when io_uring is unavailable
+std::unique_ptr<IOBackend> make_io_uring_backend(unsigned queue_depth);
+
+namespace {
+
+// Number of worker threads issuing blocking I/O for the fallback backend
+constexpr size_t kFallbackIOThreads = 4;
+
+// Perform one request with blocking system calls
+int64_t perform_io(const IORequest& request) {
+    if (request.op == IOOp::Fsync) {
+        return ::fdatasync(request.fd) == 0 ? 0 : -errno;
+    }
+
+    char* buffer = static_cast<char*>(request.buffer);
+    size_t done = 0;
+
+    while (done < request.length) {
+        ssize_t n = request.op == IOOp::Read
+            ? ::pread(request.fd, buffer + done, request.length - done, request.offset + done)
+            : ::pwrite(request.fd, buffer + done, request.length - done, request.offset + done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) break; // End of file
+        done += static_cast<size_t>(n);
+    }
+
+    return static_cast<int64_t>(done);
+}
+
+// Fallback backend: runs blocking pread/pwrite/fdatasync on a thread pool.
+// Requests linked with link_next are run in order by the same worker.
+class ThreadPoolBackend : public IOBackend {
+public:
+    explicit ThreadPoolBackend(unsigned queue_depth)
+        : pool_(std::min<size_t>(kFallbackIOThreads, std::max(1u, queue_depth))) {}
+
+    ~ThreadPoolBackend() override {
+        pool_.wait_idle();
+    }
+
+    void prepare(const IORequest& request) override {
+        if (pending_.empty() || !pending_.back().back().link_next) {
+            pending_.emplace_back();
+        }
+        pending_.back().push_back(request);
+    }
+
+    size_t submit() override {
+        size_t count = 0;
+
+        for (auto& chain : pending_) {
+            count += chain.size();
+            pool_.submit([this, chain = std::move(chain)]() {
+                bool failed = false;
+                for (const auto& request : chain) {
+                    // A failed request cancels the rest of its chain
+                    int64_t result = failed ? -ECANCELED : perform_io(request);
+                    failed = failed || result < 0;
+                    complete(IOCompletion{request.user_data, result});
+                }
+            });
+        }
+
+        pending_.clear();
+        in_flight_ += count;
+        return count;
+    }
+
+    size_t reap(std::vector<IOCompletion>& out, size_t min_complete) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        size_t wanted = std::min(min_complete, in_flight_);
+        completed_cv_.wait(lock, [&] { return completed_.size() >= wanted; });
+
+        size_t n = completed_.size();
+        out.insert(out.end(), completed_.begin(), completed_.end());
+        completed_.clear();
+        in_flight_ -= n;
+        return n;
+    }
+
+    bool register_buffers(const std::vector<std::pair<void*, size_t>>&) override {
+        return true; // Nothing to register for plain system calls
+    }
+
+    size_t in_flight() const override { return in_flight_; }
+
+    const char* name() const override { return "threadpool"; }
+
+private:
+    ThreadPool pool_;
+    std::vector<std::vector<IORequest>> pending_; // Chains of linked requests
+    size_t in_flight_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable completed_cv_;
+    std::vector<IOCompletion> completed_;
+
+    void complete(const IOCompletion& completion) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            completed_.push_back(completion);
+        }
+        completed_cv_.notify_one();
+    }
+};
+
+} // namespace
+
+std::unique_ptr<IOBackend> make_io_backend(IOBackendKind kind, unsigned queue_depth) {
+    if (kind != IOBackendKind::ThreadPool) {
+        auto backend = make_io_uring_backend(queue_depth);
+        if (backend || kind == IOBackendKind::IoUring) {
+            return backend;
+        }
+    }
+    return std::make_unique<ThreadPoolBackend>(queue_depth);
+}
+
+int64_t run_io(IOBackend& backend, const IORequest& request) {
+    backend.prepare(request);
+    backend.submit();
+
+    // Other completions reaped along the way are dropped, so this must not
+    // be mixed with batched requests on the same backend
+    std::vector<IOCompletion> completions;
+    while (true) {
+        completions.clear();
+        backend.reap(completions, 1);
+        for (const auto& completion : completions) {
+            if (completion.user_data == request.user_data) {
+                return completion.result;
+            }
+        }
+    }
+}
+
+} // namespace storage
+} // namespace toydb
@@ -0,0 +1,350 @@
+#include "../../include/storage/io_backend.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define TOYDB_HAVE_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#endif
+
+namespace toydb {
+namespace storage {
+
+#ifdef TOYDB_HAVE_IO_URING
+
+namespace {
+
+// Thin wrappers over the raw system calls (no liburing dependency)
+int sys_io_uring_setup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                                      flags, nullptr, 0));
+}
+
+int sys_io_uring_register(int fd, unsigned opcode, const void* arg, unsigned nr_args) {
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+template<typename T>
+T* ring_field(void* base, uint32_t offset) {
+    return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+// io_uring backend: requests are written straight into the shared
+// submission ring and issued with a single io_uring_enter per batch
+class UringBackend : public IOBackend {
+public:
+    ~UringBackend() override {
+        if (sqes_) ::munmap(sqes_, sqes_size_);
+        if (cq_ptr_ && cq_ptr_ != sq_ptr_) ::munmap(cq_ptr_, cq_size_);
+        if (sq_ptr_) ::munmap(sq_ptr_, sq_size_);
+        if (ring_fd_ >= 0) ::close(ring_fd_);
+    }
+
+    static std::unique_ptr<UringBackend> create(unsigned entries) {
+        std::unique_ptr<UringBackend> ring(new UringBackend());
+        if (!ring->setup(entries)) {
+            return nullptr;
+        }
+        return ring;
+    }
+
+    void prepare(const IORequest& request) override {
+        // The rest of a chain that could not be queued whole fails with it
+        if (chain_failed_) {
+            failed_.push_back(IOCompletion{request.user_data, -EINVAL});
+            chain_failed_ = request.link_next;
+            return;
+        }
+
+        // Make room if the application side of the ring is full, submitting
+        // only what precedes the open chain so the kernel sees it whole
+        if (sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+            bool chained = in_chain_;
+            unsigned chain = chained ? std::min(sqe_tail_ - chain_start_, to_submit_) : 0;
+            if (chain >= sq_entries_) {
+                // Longer than the ring; it can only be refused
+                fail_prepared(-EINVAL);
+            } else {
+                enter(to_submit_ - chain);
+            }
+            if (chained && !in_chain_) {
+                // The open chain was failed along with the prepared entries
+                failed_.push_back(IOCompletion{request.user_data, failed_.back().result});
+                chain_failed_ = request.link_next;
+                return;
+            }
+        }
+
+        if (!in_chain_) {
+            chain_start_ = sqe_tail_;
+        }
+        in_chain_ = request.link_next;
+
+        unsigned index = sqe_tail_ & *sq_mask_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+
+        sqe->fd = request.fd;
+        sqe->user_data = request.user_data;
+        if (request.link_next) {
+            sqe->flags |= IOSQE_IO_LINK;
+        }
+
+        if (request.op == IOOp::Fsync) {
+            sqe->opcode = IORING_OP_FSYNC;
+            sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        } else {
+            bool fixed = request.buffer_index >= 0 && buffers_registered_;
+            if (request.op == IOOp::Read) {
+                sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+            } else {
+                sqe->opcode = fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+            }
+            sqe->addr = reinterpret_cast<uint64_t>(request.buffer);
+            sqe->len = static_cast<uint32_t>(request.length);
+            sqe->off = request.offset;
+            if (fixed) {
+                sqe->buf_index = static_cast<uint16_t>(request.buffer_index);
+            }
+        }
+
+        sq_array_[index] = index;
+        sqe_tail_++;
+        to_submit_++;
+    }
+
+    size_t submit() override {
+        return enter(to_submit_);
+    }
+
+    size_t reap(std::vector<IOCompletion>& out, size_t min_complete) override {
+        // Requests failed before reaching the kernel complete first
+        size_t failed = failed_.size();
+        out.insert(out.end(), failed_.begin(), failed_.end());
+        failed_.clear();
+
+        size_t wanted = std::min(min_complete, in_flight_ + failed);
+        size_t reaped = failed;
+
+        while (true) {
+            unsigned head = *cq_head_;
+            unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+
+            while (head != tail) {
+                const io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+                out.push_back(IOCompletion{cqe.user_data, cqe.res});
+                head++;
+                reaped++;
+            }
+            __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+            if (reaped >= wanted) {
+                break;
+            }
+
+            int rc = sys_io_uring_enter(ring_fd_, 0, static_cast<unsigned>(wanted - reaped),
+                                        IORING_ENTER_GETEVENTS);
+            if (rc < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                break;
+            }
+        }
+
+        in_flight_ -= reaped - failed;
+        return reaped;
+    }
+
+    bool register_buffers(const std::vector<std::pair<void*, size_t>>& buffers) override {
+        if (buffers_registered_) {
+            sys_io_uring_register(ring_fd_, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+            buffers_registered_ = false;
+        }
+
+        std::vector<iovec> iovecs;
+        iovecs.reserve(buffers.size());
+        for (const auto& [base, length] : buffers) {
+            iovecs.push_back(iovec{base, length});
+        }
+
+        buffers_registered_ = sys_io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS,
+                                                    iovecs.data(),
+                                                    static_cast<unsigned>(iovecs.size())) == 0;
+        return buffers_registered_;
+    }
+
+    size_t in_flight() const override { return in_flight_ + to_submit_ + failed_.size(); }
+
+    const char* name() const override { return "io_uring"; }
+
+private:
+    int ring_fd_ = -1;
+
+    void* sq_ptr_ = nullptr;
+    size_t sq_size_ = 0;
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_mask_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_entries_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+
+    void* cq_ptr_ = nullptr;
+    size_t cq_size_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned* cq_mask_ = nullptr;
+    io_uring_cqe* cqes_ = nullptr;
+
+    unsigned sqe_tail_ = 0;   // Local tail, published on submit
+    unsigned to_submit_ = 0;  // Prepared but not yet submitted
+    size_t in_flight_ = 0;    // Submitted but not yet reaped
+    bool buffers_registered_ = false;
+
+    unsigned chain_start_ = 0;    // Local index of the open chain's first entry
+    bool in_chain_ = false;       // The last prepared entry links to the next
+    bool chain_failed_ = false;   // Fail requests until the failed chain ends
+    std::vector<IOCompletion> failed_;  // Never reached the kernel; handed out by reap
+
+    // Publish and submit the oldest count prepared entries. On a hard error
+    // every prepared entry is withdrawn and completed with the error.
+    size_t enter(unsigned count) {
+        unsigned first = sqe_tail_ - to_submit_;
+        __atomic_store_n(sq_tail_, first + count, __ATOMIC_RELEASE);
+
+        size_t submitted = 0;
+        while (submitted < count) {
+            int n = sys_io_uring_enter(ring_fd_, count - static_cast<unsigned>(submitted), 0, 0);
+            if (n < 0) {
+                if (errno == EINTR || errno == EAGAIN || errno == EBUSY) continue;
+                int error = errno;
+                in_flight_ += submitted;
+                fail_prepared(-error);
+                return submitted;
+            }
+            to_submit_ -= static_cast<unsigned>(n);
+            submitted += static_cast<size_t>(n);
+        }
+
+        in_flight_ += submitted;
+        return submitted;
+    }
+
+    // Withdraw the prepared entries from the ring; without SQPOLL the kernel
+    // only reads them during io_uring_enter, so the tail can move back
+    void fail_prepared(int64_t error) {
+        for (unsigned i = sqe_tail_ - to_submit_; i != sqe_tail_; ++i) {
+            failed_.push_back(IOCompletion{sqes_[sq_array_[i & *sq_mask_]].user_data, error});
+        }
+        sqe_tail_ -= to_submit_;
+        to_submit_ = 0;
+        __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+
+        // Later members of a chain cut short fail as well
+        chain_failed_ = in_chain_;
+        in_chain_ = false;
+    }
+
+    UringBackend() = default;
+
+    bool setup(unsigned entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+
+        ring_fd_ = sys_io_uring_setup(entries, &params);
+        if (ring_fd_ < 0) {
+            return false; // Not supported by the kernel or blocked by seccomp
+        }
+
+        sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+        }
+
+        sq_ptr_ = ::mmap(nullptr, sq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ptr_ == MAP_FAILED) {
+            sq_ptr_ = nullptr;
+            return false;
+        }
+
+        if (single_mmap) {
+            cq_ptr_ = sq_ptr_;
+        } else {
+            cq_ptr_ = ::mmap(nullptr, cq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                             ring_fd_, IORING_OFF_CQ_RING);
+            if (cq_ptr_ == MAP_FAILED) {
+                cq_ptr_ = nullptr;
+                return false;
+            }
+        }
+
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            ring_fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return false;
+        }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        sq_head_ = ring_field<unsigned>(sq_ptr_, params.sq_off.head);
+        sq_tail_ = ring_field<unsigned>(sq_ptr_, params.sq_off.tail);
+        sq_mask_ = ring_field<unsigned>(sq_ptr_, params.sq_off.ring_mask);
+        sq_array_ = ring_field<unsigned>(sq_ptr_, params.sq_off.array);
+        sq_entries_ = params.sq_entries;
+        sqe_tail_ = *sq_tail_;
+
+        cq_head_ = ring_field<unsigned>(cq_ptr_, params.cq_off.head);
+        cq_tail_ = ring_field<unsigned>(cq_ptr_, params.cq_off.tail);
+        cq_mask_ = ring_field<unsigned>(cq_ptr_, params.cq_off.ring_mask);
+        cqes_ = ring_field<io_uring_cqe>(cq_ptr_, params.cq_off.cqes);
+
+        return supports_required_ops();
+    }
+
+    // IORING_OP_READ/WRITE need Linux 5.6; older kernels use the fallback
+    bool supports_required_ops() {
+        constexpr unsigned kProbeOps = 256;
+        std::vector<char> storage(sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op));
+        auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+
+        if (sys_io_uring_register(ring_fd_, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+            return false;
+        }
+
+        for (unsigned op : {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_FSYNC,
+                            IORING_OP_READ_FIXED, IORING_OP_WRITE_FIXED}) {
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+std::unique_ptr<IOBackend> make_io_uring_backend(unsigned queue_depth) {
+    return UringBackend::create(queue_depth);
+}
+
+#else
+
+std::unique_ptr<IOBackend> make_io_uring_backend(unsigned) {
+    return nullptr;
+}
+
+#endif
+
+} // namespace storage
+} // namespace toydb
@@ -0,0 +1,686 @@
+#include "../../include/storage/lsm_tree.h"
+#include "../../include/storage/bloom_filter.h"
+#include "../../include/storage/bplustree.h"
+#include "../../include/metrics/metrics.h"
+#include "../../include/metrics/trace.h"
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace toydb {
+namespace storage {
+
+namespace {
+
+struct LsmMetrics {
+    metrics::Counter& puts;
+    metrics::Counter& removes;
+    metrics::Counter& gets;
+    metrics::Counter& run_probes;       // Runs whose blocks a get had to read
+    metrics::Counter& filter_skips;     // Runs a get skipped on their Bloom filter
+    metrics::Counter& flushes;
+    metrics::Counter& compactions;
+    metrics::Counter& compaction_bytes;
+    metrics::Counter& write_stalls;
+    metrics::Counter& background_errors;  // Flushes and compactions that failed
+    metrics::Histogram& flush_latency;
+    metrics::Histogram& compaction_latency;
+};
+
+LsmMetrics& lsm_metrics() {
+    static LsmMetrics m{
+        metrics::counter("lsm.put"),
+        metrics::counter("lsm.remove"),
+        metrics::counter("lsm.get"),
+        metrics::counter("lsm.get.run_probes"),
+        metrics::counter("lsm.get.filter_skips"),
+        metrics::counter("lsm.flush"),
+        metrics::counter("lsm.compaction"),
+        metrics::counter("lsm.compaction.bytes_written"),
+        metrics::counter("lsm.write_stalls"),
+        metrics::counter("lsm.background_errors"),
+        metrics::histogram("lsm.flush.latency"),
+        metrics::histogram("lsm.compaction.latency"),
+    };
+    return m;
+}
+
+// Memtable bytes charged per entry on top of its key and value: the skip
+// list node, its tower and the string headers
+constexpr size_t kEntryOverhead = 96;
+
+void put_u32(std::string& out, uint32_t value) {
+    char bytes[4];
+    std::memcpy(bytes, &value, sizeof(bytes));
+    out.append(bytes, sizeof(bytes));
+}
+
+uint32_t get_u32(const char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+void write_all(int fd, const std::string& data, const std::string& path) {
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t n = ::write(fd, data.data() + done, data.size() - done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Cannot write run file " + path + ": " + std::strerror(errno));
+        }
+        done += static_cast<size_t>(n);
+    }
+}
+
+void read_exact(int fd, char* buffer, size_t length, uint64_t offset) {
+    size_t done = 0;
+    while (done < length) {
+        ssize_t n = ::pread(fd, buffer + done, length - done, static_cast<off_t>(offset + done));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            throw std::runtime_error(std::string("Cannot read run file: ") +
+                                     (n < 0 ? std::strerror(errno) : "unexpected end of file"));
+        }
+        done += static_cast<size_t>(n);
+    }
+}
+
+} // namespace
+
+// An immutable run of entries sorted by key, in one file of data blocks.
+// Each block holds whole entries, encoded as
+//   u32 key length, key, u8 deleted, u32 value length, value
+// The first key of every block and a Bloom filter over all keys stay in
+// memory; the file is deleted when the last reference to the run goes.
+class LsmTree::SortedRun {
+public:
+    struct Record {
+        std::string key;
+        Entry entry;
+    };
+
+    // Writes a run from entries added in key order
+    class Builder {
+    public:
+        Builder(std::string path, size_t block_bytes, size_t expected_entries)
+            : run_(std::make_shared<SortedRun>()), block_bytes_(block_bytes) {
+            run_->path_ = std::move(path);
+            run_->filter_.reset(expected_entries);
+            run_->fd_ = ::open(run_->path_.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (run_->fd_ < 0) {
+                throw std::runtime_error("Cannot create run file " + run_->path_ + ": " +
+                                         std::strerror(errno));
+            }
+        }
+
+        void add(const std::string& key, const Entry& entry) {
+            if (block_.empty()) {
+                run_->blocks_.push_back({key, offset_, 0});
+            }
+            put_u32(block_, static_cast<uint32_t>(key.size()));
+            block_ += key;
+            block_.push_back(entry.deleted ? 1 : 0);
+            put_u32(block_, static_cast<uint32_t>(entry.value.size()));
+            block_ += entry.value;
+
+            run_->filter_.add(hash_key(key));
+            run_->largest_ = key;
+            run_->entries_++;
+            if (block_.size() >= block_bytes_) {
+                finish_block();
+            }
+        }
+
+        // The finished run, or nullptr if no entries were added
+        std::shared_ptr<SortedRun> finish() {
+            finish_block();
+            if (run_->entries_ == 0) {
+                return nullptr;
+            }
+            run_->smallest_ = run_->blocks_.front().first_key;
+            run_->file_bytes_ = offset_;
+            return std::move(run_);
+        }
+
+    private:
+        std::shared_ptr<SortedRun> run_;
+        size_t block_bytes_;
+        std::string block_;
+        uint64_t offset_ = 0;
+
+        void finish_block() {
+            if (block_.empty()) return;
+            write_all(run_->fd_, block_, run_->path_);
+            run_->blocks_.back().size = static_cast<uint32_t>(block_.size());
+            offset_ += block_.size();
+            block_.clear();
+        }
+    };
+
+    SortedRun() = default;
+
+    ~SortedRun() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            ::unlink(path_.c_str());
+        }
+    }
+
+    SortedRun(const SortedRun&) = delete;
+    SortedRun& operator=(const SortedRun&) = delete;
+
+    // False when the key is outside the run's range or rejected by its filter
+    bool may_contain(const std::string& key) const {
+        return key >= smallest_ && key <= largest_ && filter_.may_contain(hash_key(key));
+    }
+
+    // Find a key's entry; false if the run does not hold the key
+    bool get(const std::string& key, Entry& entry) const {
+        size_t block = find_block(key);
+        std::string data = read_block(block);
+        const char* p = data.data();
+        const char* end = p + data.size();
+        while (p < end) {
+            uint32_t key_size = get_u32(p);
+            p += 4;
+            int cmp = key.compare(0, std::string::npos, p, key_size);
+            bool deleted = p[key_size] != 0;
+            p += key_size + 1;
+            uint32_t value_size = get_u32(p);
+            p += 4;
+            if (cmp == 0) {
+                entry.deleted = deleted;
+                entry.value.assign(p, value_size);
+                return true;
+            }
+            if (cmp < 0) {
+                return false;
+            }
+            p += value_size;
+        }
+        return false;
+    }
+
+    // Decode one block's entries
+    void read_records(size_t block, std::vector<Record>& out) const {
+        out.clear();
+        std::string data = read_block(block);
+        const char* p = data.data();
+        const char* end = p + data.size();
+        while (p < end) {
+            Record record;
+            uint32_t key_size = get_u32(p);
+            record.key.assign(p + 4, key_size);
+            p += 4 + key_size;
+            record.entry.deleted = *p++ != 0;
+            uint32_t value_size = get_u32(p);
+            record.entry.value.assign(p + 4, value_size);
+            p += 4 + value_size;
+            out.push_back(std::move(record));
+        }
+    }
+
+    // Last block whose first key is <= key (block 0 for smaller keys)
+    size_t find_block(const std::string& key) const {
+        auto it = std::upper_bound(blocks_.begin(), blocks_.end(), key,
+                                   [](const std::string& k, const BlockHandle& block) {
+                                       return k < block.first_key;
+                                   });
+        return it == blocks_.begin() ? 0 : static_cast<size_t>(it - blocks_.begin()) - 1;
+    }
+
+    size_t blocks() const { return blocks_.size(); }
+    size_t entries() const { return entries_; }
+    size_t file_bytes() const { return file_bytes_; }
+
+    size_t index_bytes() const {
+        size_t bytes = blocks_.capacity() * sizeof(BlockHandle) + filter_.memory_bytes();
+        for (const auto& block : blocks_) {
+            bytes += heap_bytes(block.first_key);
+        }
+        return bytes;
+    }
+
+private:
+    struct BlockHandle {
+        std::string first_key;
+        uint64_t offset;
+        uint32_t size;
+    };
+
+    std::string path_;
+    int fd_ = -1;
+    std::vector<BlockHandle> blocks_;
+    BloomFilter filter_;
+    std::string smallest_;
+    std::string largest_;
+    size_t entries_ = 0;
+    size_t file_bytes_ = 0;
+
+    std::string read_block(size_t block) const {
+        const BlockHandle& handle = blocks_[block];
+        std::string data(handle.size, '\0');
+        read_exact(fd_, data.data(), handle.size, handle.offset);
+        return data;
+    }
+};
+
+// Merges memtables and runs into one stream in key order. Sources are
+// given newest first; when several hold a key, the newest entry is
+// returned and the older ones are skipped. Tombstones are returned too.
+class LsmTree::MergeIterator {
+public:
+    MergeIterator(const std::vector<const MemTable*>& memtables,
+                  const std::vector<RunPtr>& runs, const std::string& start) {
+        for (const MemTable* memtable : memtables) {
+            Source source;
+            source.memtable = memtable->lower_bound(start);
+            source.valid = source.memtable.valid();
+            sources_.push_back(std::move(source));
+        }
+        for (const auto& run : runs) {
+            Source source;
+            source.run = run.get();
+            source.block = run->find_block(start);
+            run->read_records(source.block, source.records);
+            source.position = std::lower_bound(
+                source.records.begin(), source.records.end(), start,
+                [](const SortedRun::Record& record, const std::string& key) {
+                    return record.key < key;
+                }) - source.records.begin();
+            source.settle();
+            sources_.push_back(std::move(source));
+        }
+        pick();
+    }
+
+    bool valid() const { return current_ != nullptr; }
+    const std::string& key() const { return current_->key(); }
+    const Entry& entry() const { return current_->entry(); }
+
+    void next() {
+        std::string key = current_->key();
+        for (auto& source : sources_) {
+            if (source.valid && source.key() == key) {
+                source.next();
+            }
+        }
+        pick();
+    }
+
+private:
+    struct Source {
+        bool valid = false;
+        MemTable::Iterator memtable;        // Used when run is null
+        const SortedRun* run = nullptr;
+        size_t block = 0;
+        std::vector<SortedRun::Record> records;
+        size_t position = 0;
+
+        const std::string& key() const {
+            return run ? records[position].key : memtable.key();
+        }
+
+        const Entry& entry() const {
+            return run ? records[position].entry : memtable.value();
+        }
+
+        void next() {
+            if (run) {
+                position++;
+                settle();
+            } else {
+                memtable.next();
+                valid = memtable.valid();
+            }
+        }
+
+        // Move past the end of exhausted blocks
+        void settle() {
+            while (position >= records.size() && block + 1 < run->blocks()) {
+                run->read_records(++block, records);
+                position = 0;
+            }
+            valid = position < records.size();
+        }
+    };
+
+    std::vector<Source> sources_;
+    const Source* current_ = nullptr;
+
+    void pick() {
+        current_ = nullptr;
+        for (const auto& source : sources_) {
+            if (source.valid && (!current_ || source.key() < current_->key())) {
+                current_ = &source;
+            }
+        }
+    }
+};
+
+// LsmTree implementation
+LsmTree::LsmTree(LsmOptions options)
+    : options_(std::move(options)), memtable_(std::make_unique<MemTable>()) {
+    std::error_code ec;
+    std::filesystem::create_directories(options_.directory, ec);
+    if (ec) {
+        throw std::runtime_error("Cannot create LSM directory " + options_.directory + ": " +
+                                 ec.message());
+    }
+    levels_.resize(1);
+}
+
+LsmTree::~LsmTree() {
+    worker_.wait_idle();
+    // Dropping the runs deletes their files, leaving the directory empty
+    levels_.clear();
+    std::error_code ec;
+    std::filesystem::remove(options_.directory, ec);
+}
+
+void LsmTree::put(const std::string& key, std::string value) {
+    lsm_metrics().puts.add();
+    write(key, Entry{std::move(value), false});
+}
+
+void LsmTree::remove(const std::string& key) {
+    lsm_metrics().removes.add();
+    write(key, Entry{std::string(), true});
+}
+
+void LsmTree::write(const std::string& key, Entry entry) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    check_background_error();
+    // Rotate a full memtable before inserting, so a write that fails on a
+    // background error leaves nothing behind
+    if (memtable_bytes_ >= options_.memtable_bytes) {
+        schedule_flush(lock);
+    }
+    memtable_bytes_ += key.size() + entry.value.size() + kEntryOverhead;
+    memtable_->insert_or_assign(key, std::move(entry));
+}
+
+void LsmTree::schedule_flush(std::unique_lock<std::shared_mutex>& lock) {
+    // Only one memtable is flushed at a time, and level 0 is kept from
+    // outgrowing compaction; writers wait for either to clear
+    auto writable = [this] {
+        return !background_error_.empty() ||
+               (!immutable_ && levels_[0].size() < options_.level0_stall_runs);
+    };
+    if (!writable()) {
+        lsm_metrics().write_stalls.add();
+        TOYDB_TRACE_SPAN("lsm.write_stall", "lsm");
+        writable_.wait(lock, writable);
+    }
+    check_background_error();
+    immutable_ = std::move(memtable_);
+    immutable_bytes_ = memtable_bytes_;
+    memtable_ = std::make_unique<MemTable>();
+    memtable_bytes_ = 0;
+
+    worker_.submit([this] {
+        flush_immutable();
+        schedule_compaction();
+    });
+}
+
+void LsmTree::flush_immutable() {
+    TOYDB_TRACE_SPAN("lsm.flush", "lsm");
+    metrics::ScopedTimer timer(lsm_metrics().flush_latency);
+
+    std::shared_ptr<const MemTable> memtable;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        memtable = immutable_;
+    }
+
+    // A failed build deletes its partial file; the memtable stays readable
+    // as the immutable one
+    RunPtr run;
+    try {
+        SortedRun::Builder builder(run_path(next_run_id_++), options_.block_bytes,
+                                   memtable->size());
+        for (auto it = memtable->begin(); it.valid(); it.next()) {
+            builder.add(it.key(), it.value());
+        }
+        run = builder.finish();
+    } catch (const std::exception& e) {
+        fail_background(std::string("flush failed: ") + e.what());
+        return;
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (run) {
+            levels_[0].insert(levels_[0].begin(), std::move(run));
+        }
+        immutable_.reset();
+        immutable_bytes_ = 0;
+    }
+    writable_.notify_all();
+    lsm_metrics().flushes.add();
+}
+
+void LsmTree::schedule_compaction() {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (!background_error_.empty()) {
+            return;
+        }
+    }
+
+    // One compaction at a time; a flush that lands while one is running is
+    // picked up by its re-check
+    if (compacting_.exchange(true)) {
+        return;
+    }
+    worker_.submit([this] {
+        compact();
+        compacting_ = false;
+        bool due;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            due = background_error_.empty() && levels_[0].size() >= options_.level0_runs;
+        }
+        if (due) {
+            schedule_compaction();
+        }
+    });
+}
+
+void LsmTree::compact() {
+    // Flushes only ever add runs to the front of level 0 while this runs,
+    // so the inputs are removed by identity rather than by clearing level 0
+    for (size_t level = 0;; ++level) {
+        std::vector<RunPtr> inputs;
+        size_t merged_level_runs = 0;
+        bool bottom = true;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            if (level >= levels_.size()) {
+                break;
+            }
+            size_t bytes = 0;
+            for (const auto& run : levels_[level]) {
+                bytes += run->file_bytes();
+            }
+            bool due = level == 0 ? levels_[0].size() >= options_.level0_runs
+                                  : bytes > level_target_bytes(level);
+            if (!due) {
+                continue;
+            }
+
+            inputs = levels_[level];
+            merged_level_runs = inputs.size();
+            if (level + 1 < levels_.size()) {
+                inputs.insert(inputs.end(), levels_[level + 1].begin(), levels_[level + 1].end());
+            }
+            for (size_t deeper = level + 2; deeper < levels_.size(); ++deeper) {
+                bottom = bottom && levels_[deeper].empty();
+            }
+        }
+
+        TOYDB_TRACE_SPAN("lsm.compact", "lsm");
+        metrics::ScopedTimer timer(lsm_metrics().compaction_latency);
+
+        size_t expected = 0;
+        for (const auto& run : inputs) {
+            expected += run->entries();
+        }
+
+        // The inputs are only swapped out once the merged run is complete
+        RunPtr run;
+        try {
+            SortedRun::Builder builder(run_path(next_run_id_++), options_.block_bytes, expected);
+            for (MergeIterator it({}, inputs, std::string()); it.valid(); it.next()) {
+                // Nothing older than the bottom level can be shadowed
+                if (bottom && it.entry().deleted) {
+                    continue;
+                }
+                builder.add(it.key(), it.entry());
+            }
+            run = builder.finish();
+        } catch (const std::exception& e) {
+            fail_background(std::string("compaction failed: ") + e.what());
+            return;
+        }
+        if (run) {
+            lsm_metrics().compaction_bytes.add(run->file_bytes());
+        }
+
+        {
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            auto& source = levels_[level];
+            source.erase(source.end() - static_cast<std::ptrdiff_t>(merged_level_runs), source.end());
+            if (level + 1 >= levels_.size()) {
+                levels_.resize(level + 2);
+            }
+            levels_[level + 1].clear();
+            if (run) {
+                levels_[level + 1].push_back(std::move(run));
+            }
+        }
+        writable_.notify_all();
+        lsm_metrics().compactions.add();
+    }
+}
+
+std::optional<std::string> LsmTree::get(const std::string& key) const {
+    LsmMetrics& m = lsm_metrics();
+    m.gets.add();
+    TOYDB_TRACE_SPAN("lsm.get", "lsm");
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    const MemTable* memtables[] = {memtable_.get(), immutable_.get()};
+    for (const MemTable* memtable : memtables) {
+        if (!memtable) continue;
+        if (const Entry* entry = memtable->find(key)) {
+            return entry->deleted ? std::nullopt : std::optional<std::string>(entry->value);
+        }
+    }
+
+    Entry entry;
+    for (const auto& level : levels_) {
+        for (const auto& run : level) {
+            if (!run->may_contain(key)) {
+                m.filter_skips.add();
+                continue;
+            }
+            m.run_probes.add();
+            if (run->get(key, entry)) {
+                return entry.deleted ? std::nullopt : std::optional<std::string>(entry.value);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void LsmTree::scan(const std::string& start,
+                   const std::function<bool(const std::string&, const std::string&)>& func) const {
+    TOYDB_TRACE_SPAN("lsm.scan", "lsm");
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    std::vector<const MemTable*> memtables{memtable_.get()};
+    if (immutable_) {
+        memtables.push_back(immutable_.get());
+    }
+    std::vector<RunPtr> runs;
+    for (const auto& level : levels_) {
+        runs.insert(runs.end(), level.begin(), level.end());
+    }
+
+    for (MergeIterator it(memtables, runs, start); it.valid(); it.next()) {
+        if (!it.entry().deleted && !func(it.key(), it.entry().value)) {
+            return;
+        }
+    }
+}
+
+void LsmTree::flush() {
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        check_background_error();
+        if (!memtable_->empty()) {
+            schedule_flush(lock);
+        }
+    }
+    worker_.wait_idle();
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    check_background_error();
+}
+
+void LsmTree::fail_background(const std::string& error) {
+    lsm_metrics().background_errors.add();
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (background_error_.empty()) {
+            background_error_ = error;
+        }
+    }
+    writable_.notify_all();
+}
+
+void LsmTree::check_background_error() const {
+    if (!background_error_.empty()) {
+        throw std::runtime_error("LSM tree is read-only after a " + background_error_);
+    }
+}
+
+LsmStats LsmTree::stats() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    LsmStats stats;
+    stats.memtable_entries = memtable_->size() + (immutable_ ? immutable_->size() : 0);
+    stats.memtable_bytes = memtable_bytes_ + immutable_bytes_;
+    for (const auto& level : levels_) {
+        if (!level.empty()) {
+            stats.levels++;
+        }
+        for (const auto& run : level) {
+            stats.runs++;
+            stats.disk_bytes += run->file_bytes();
+            stats.index_bytes += run->index_bytes();
+        }
+    }
+    return stats;
+}
+
+size_t LsmTree::level_target_bytes(size_t level) const {
+    size_t bytes = options_.level1_bytes;
+    for (size_t i = 1; i < level; ++i) {
+        bytes *= options_.level_size_ratio;
+    }
+    return bytes;
+}
+
+std::string LsmTree::run_path(uint64_t id) const {
+    return options_.directory + "/run-" + std::to_string(id) + ".sst";
+}
+
+} // namespace storage
+} // namespace toydb
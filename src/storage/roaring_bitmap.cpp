@@ -0,0 +1,301 @@
+#include "../../include/storage/roaring_bitmap.h"
+#include <algorithm>
+#include <iterator>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace toydb {
+namespace storage {
+
+namespace {
+
+constexpr size_t kWords = 65536 / 64;
+
+// Bit count without relying on a POPCNT instruction, which the default
+// target does not have
+inline uint64_t popcount(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (x * 0x0101010101010101ULL) >> 56;
+}
+
+uint32_t count_words(const uint64_t* words) {
+    uint64_t count = 0;
+    for (size_t i = 0; i < kWords; ++i) {
+        count += popcount(words[i]);
+    }
+    return static_cast<uint32_t>(count);
+}
+
+// out = a & b or a | b over a whole bitmap container, returning the bits set
+template<bool And>
+uint32_t combine_words(const uint64_t* a, const uint64_t* b, uint64_t* out) {
+#if defined(__SSE2__)
+    for (size_t i = 0; i < kWords; i += 2) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128i r = And ? _mm_and_si128(x, y) : _mm_or_si128(x, y);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), r);
+    }
+#else
+    for (size_t i = 0; i < kWords; ++i) {
+        out[i] = And ? (a[i] & b[i]) : (a[i] | b[i]);
+    }
+#endif
+    return count_words(out);
+}
+
+inline bool test_bit(const std::vector<uint64_t>& bits, uint16_t low) {
+    return (bits[low >> 6] >> (low & 63)) & 1;
+}
+
+} // namespace
+
+// Container conversions
+void RoaringBitmap::Container::to_bitmap() {
+    bits.assign(kWords, 0);
+    for (uint16_t low : array) {
+        bits[low >> 6] |= uint64_t{1} << (low & 63);
+    }
+    array.clear();
+    array.shrink_to_fit();
+}
+
+void RoaringBitmap::Container::to_array() {
+    array.clear();
+    array.reserve(cardinality);
+    for (size_t w = 0; w < kWords; ++w) {
+        uint64_t word = bits[w];
+        while (word) {
+            array.push_back(static_cast<uint16_t>(w * 64 + __builtin_ctzll(word)));
+            word &= word - 1;
+        }
+    }
+    bits.clear();
+    bits.shrink_to_fit();
+}
+
+RoaringBitmap::Container* RoaringBitmap::find(uint16_t key) {
+    auto it = std::lower_bound(containers_.begin(), containers_.end(), key,
+                               [](const Container& c, uint16_t k) { return c.key < k; });
+    return it != containers_.end() && it->key == key ? &*it : nullptr;
+}
+
+const RoaringBitmap::Container* RoaringBitmap::find(uint16_t key) const {
+    return const_cast<RoaringBitmap*>(this)->find(key);
+}
+
+void RoaringBitmap::add(uint32_t value) {
+    uint16_t key = static_cast<uint16_t>(value >> 16);
+    uint16_t low = static_cast<uint16_t>(value);
+
+    auto it = std::lower_bound(containers_.begin(), containers_.end(), key,
+                               [](const Container& c, uint16_t k) { return c.key < k; });
+    if (it == containers_.end() || it->key != key) {
+        it = containers_.insert(it, Container{});
+        it->key = key;
+    }
+
+    Container& c = *it;
+    if (c.is_bitmap()) {
+        uint64_t& word = c.bits[low >> 6];
+        uint64_t bit = uint64_t{1} << (low & 63);
+        if (!(word & bit)) {
+            word |= bit;
+            c.cardinality++;
+        }
+        return;
+    }
+
+    auto pos = std::lower_bound(c.array.begin(), c.array.end(), low);
+    if (pos != c.array.end() && *pos == low) {
+        return;
+    }
+    c.array.insert(pos, low);
+    c.cardinality++;
+    if (c.array.size() > kArrayMax) {
+        c.to_bitmap();
+    }
+}
+
+void RoaringBitmap::remove(uint32_t value) {
+    Container* c = find(static_cast<uint16_t>(value >> 16));
+    if (!c) {
+        return;
+    }
+
+    uint16_t low = static_cast<uint16_t>(value);
+    if (c->is_bitmap()) {
+        uint64_t& word = c->bits[low >> 6];
+        uint64_t bit = uint64_t{1} << (low & 63);
+        if (!(word & bit)) {
+            return;
+        }
+        word &= ~bit;
+        if (--c->cardinality <= kArrayMax) {
+            c->to_array();
+        }
+    } else {
+        auto pos = std::lower_bound(c->array.begin(), c->array.end(), low);
+        if (pos == c->array.end() || *pos != low) {
+            return;
+        }
+        c->array.erase(pos);
+        c->cardinality--;
+    }
+
+    if (c->cardinality == 0) {
+        containers_.erase(containers_.begin() + (c - containers_.data()));
+    }
+}
+
+bool RoaringBitmap::contains(uint32_t value) const {
+    const Container* c = find(static_cast<uint16_t>(value >> 16));
+    if (!c) {
+        return false;
+    }
+    uint16_t low = static_cast<uint16_t>(value);
+    if (c->is_bitmap()) {
+        return test_bit(c->bits, low);
+    }
+    return std::binary_search(c->array.begin(), c->array.end(), low);
+}
+
+size_t RoaringBitmap::cardinality() const {
+    size_t count = 0;
+    for (const auto& c : containers_) {
+        count += c.cardinality;
+    }
+    return count;
+}
+
+RoaringBitmap::Container RoaringBitmap::intersect(const Container& a, const Container& b) {
+    Container out;
+    out.key = a.key;
+
+    if (a.is_bitmap() && b.is_bitmap()) {
+        // The result stays a bitmap even if it is sparse enough for an
+        // array: intersections are mostly short-lived query results, and
+        // converting would cost more than the AND itself
+        out.bits.resize(kWords);
+        out.cardinality = combine_words<true>(a.bits.data(), b.bits.data(), out.bits.data());
+        return out;
+    }
+
+    if (a.is_bitmap() || b.is_bitmap()) {
+        const Container& bitmap = a.is_bitmap() ? a : b;
+        const Container& array = a.is_bitmap() ? b : a;
+        for (uint16_t low : array.array) {
+            if (test_bit(bitmap.bits, low)) {
+                out.array.push_back(low);
+            }
+        }
+    } else {
+        const auto& small = a.array.size() <= b.array.size() ? a.array : b.array;
+        const auto& large = a.array.size() <= b.array.size() ? b.array : a.array;
+        if (large.size() > 32 * small.size()) {
+            // Skewed sizes: binary search the large side for each small value
+            auto from = large.begin();
+            for (uint16_t low : small) {
+                from = std::lower_bound(from, large.end(), low);
+                if (from == large.end()) break;
+                if (*from == low) out.array.push_back(low);
+            }
+        } else {
+            std::set_intersection(small.begin(), small.end(), large.begin(), large.end(),
+                                  std::back_inserter(out.array));
+        }
+    }
+    out.cardinality = static_cast<uint32_t>(out.array.size());
+    return out;
+}
+
+RoaringBitmap::Container RoaringBitmap::unite(const Container& a, const Container& b) {
+    Container out;
+    out.key = a.key;
+
+    if (a.is_bitmap() && b.is_bitmap()) {
+        out.bits.resize(kWords);
+        out.cardinality = combine_words<false>(a.bits.data(), b.bits.data(), out.bits.data());
+        return out;
+    }
+
+    if (a.is_bitmap() || b.is_bitmap()) {
+        const Container& bitmap = a.is_bitmap() ? a : b;
+        const Container& array = a.is_bitmap() ? b : a;
+        out.bits = bitmap.bits;
+        out.cardinality = bitmap.cardinality;
+        for (uint16_t low : array.array) {
+            uint64_t& word = out.bits[low >> 6];
+            uint64_t bit = uint64_t{1} << (low & 63);
+            out.cardinality += (word & bit) == 0;
+            word |= bit;
+        }
+        return out;
+    }
+
+    out.array.reserve(a.array.size() + b.array.size());
+    std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+                   std::back_inserter(out.array));
+    out.cardinality = static_cast<uint32_t>(out.array.size());
+    if (out.array.size() > kArrayMax) {
+        out.to_bitmap();
+    }
+    return out;
+}
+
+RoaringBitmap& RoaringBitmap::operator&=(const RoaringBitmap& other) {
+    std::vector<Container> result;
+    auto a = containers_.begin();
+    auto b = other.containers_.begin();
+    while (a != containers_.end() && b != other.containers_.end()) {
+        if (a->key < b->key) {
+            ++a;
+        } else if (b->key < a->key) {
+            ++b;
+        } else {
+            Container c = intersect(*a, *b);
+            if (c.cardinality > 0) {
+                result.push_back(std::move(c));
+            }
+            ++a;
+            ++b;
+        }
+    }
+    containers_ = std::move(result);
+    return *this;
+}
+
+RoaringBitmap& RoaringBitmap::operator|=(const RoaringBitmap& other) {
+    std::vector<Container> result;
+    result.reserve(containers_.size() + other.containers_.size());
+    auto a = containers_.begin();
+    auto b = other.containers_.begin();
+    while (a != containers_.end() || b != other.containers_.end()) {
+        if (b == other.containers_.end() || (a != containers_.end() && a->key < b->key)) {
+            result.push_back(std::move(*a++));
+        } else if (a == containers_.end() || b->key < a->key) {
+            result.push_back(*b++);
+        } else {
+            result.push_back(unite(*a, *b));
+            ++a;
+            ++b;
+        }
+    }
+    containers_ = std::move(result);
+    return *this;
+}
+
+size_t RoaringBitmap::memory_bytes() const {
+    size_t bytes = containers_.capacity() * sizeof(Container);
+    for (const auto& c : containers_) {
+        bytes += c.array.capacity() * sizeof(uint16_t) + c.bits.capacity() * sizeof(uint64_t);
+    }
+    return bytes;
+}
+
+} // namespace storage
+} // namespace toydb